@@ -0,0 +1,50 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "core/generator/include/generator.hpp"
+
+TEST(generator_tests, check_blocks_match_whole_sequence) {
+  ppc::core::CounterGenerator<int32_t> gen(42, -100, 100);
+  auto whole = gen.generate(0, 1000);
+
+  std::vector<int32_t> blocks;
+  for (uint64_t first = 0; first < 1000; first += 300) {
+    auto block = gen.generate(first, first + 300 <= 1000 ? 300 : 1000 - first);
+    blocks.insert(blocks.end(), block.begin(), block.end());
+  }
+  ASSERT_EQ(blocks, whole);
+}
+
+TEST(generator_tests, check_int_range) {
+  ppc::core::CounterGenerator<int32_t> gen(7, -3, 3);
+  bool seen_min = false;
+  bool seen_max = false;
+  for (uint64_t i = 0; i < 1000; i++) {
+    auto value = gen(i);
+    ASSERT_GE(value, -3);
+    ASSERT_LE(value, 3);
+    seen_min = seen_min || value == -3;
+    seen_max = seen_max || value == 3;
+  }
+  EXPECT_TRUE(seen_min);
+  EXPECT_TRUE(seen_max);
+}
+
+TEST(generator_tests, check_double_range) {
+  ppc::core::CounterGenerator<double> gen(7, 1.0, 2.0);
+  for (uint64_t i = 0; i < 1000; i++) {
+    auto value = gen(i);
+    ASSERT_GE(value, 1.0);
+    ASSERT_LT(value, 2.0);
+  }
+}
+
+TEST(generator_tests, check_seed_changes_sequence) {
+  ppc::core::CounterGenerator<uint32_t> first(1, 0, 1000000);
+  ppc::core::CounterGenerator<uint32_t> second(2, 0, 1000000);
+  EXPECT_NE(first.generate(0, 16), second.generate(0, 16));
+  EXPECT_EQ(first.generate(0, 16), ppc::core::CounterGenerator<uint32_t>(1, 0, 1000000).generate(0, 16));
+}
@@ -0,0 +1,62 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_GENERATOR_HPP_
+#define MODULES_CORE_INCLUDE_GENERATOR_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace ppc::core {
+
+// Random sequence where the element with index i depends only on the seed
+// and i, so every block of the sequence can be generated independently of
+// the others and concatenated blocks match the whole sequence.
+template <class T>
+class CounterGenerator {
+  static_assert(std::is_arithmetic_v<T>, "CounterGenerator needs arithmetic elements");
+
+ public:
+  // values are in [min, max] for integers and in [min, max) for floats
+  CounterGenerator(uint64_t seed_, T min_, T max_) : seed(seed_), min(min_), max(max_) {}
+
+  T operator()(uint64_t index) const {
+    uint64_t bits = mix(seed + (index + 1) * 0x9E3779B97F4A7C15ull);
+    if constexpr (std::is_floating_point_v<T>) {
+      auto unit = static_cast<double>(bits >> 11) * 0x1.0p-53;
+      return static_cast<T>(static_cast<double>(min) + unit * (static_cast<double>(max) - static_cast<double>(min)));
+    } else {
+      auto range = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+      return static_cast<T>(static_cast<uint64_t>(min) + (range == 0 ? bits : bits % range));
+    }
+  }
+
+  // fill `count` elements starting from the element `first`
+  void fill(T *dst, uint64_t first, uint64_t count) const {
+    for (uint64_t i = 0; i < count; i++) {
+      dst[i] = (*this)(first + i);
+    }
+  }
+
+  std::vector<T> generate(uint64_t first, uint64_t count) const {
+    std::vector<T> vec(count);
+    fill(vec.data(), first, count);
+    return vec;
+  }
+
+ private:
+  // splitmix64 finalizer
+  static uint64_t mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+  uint64_t seed;
+  T min;
+  T max;
+};
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_GENERATOR_HPP_
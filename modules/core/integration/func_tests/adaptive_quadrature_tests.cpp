@@ -0,0 +1,62 @@
+// Copyright 2024 Nesterov Alexander
+#define _USE_MATH_DEFINES
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+
+#include "core/integration/include/adaptive_quadrature.hpp"
+
+TEST(adaptive_quadrature_tests, check_gauss_kronrod_is_exact_for_polynomials) {
+  auto result = ppc::core::adaptive_integrate([](double x) { return std::pow(x, 9) - (3 * x * x); }, -1.0, 2.0, 1e-12);
+  EXPECT_NEAR(result.value, (1024.0 - 1.0) / 10 - 9.0, 1e-11);
+  // a single interval is enough
+  EXPECT_EQ(result.evaluations, 15);
+}
+
+TEST(adaptive_quadrature_tests, check_tolerance_is_reached) {
+  auto f = [](double x) { return std::sqrt(x); };
+  for (auto rule : {ppc::core::SIMPSON, ppc::core::GAUSS_KRONROD_15}) {
+    auto result = ppc::core::adaptive_integrate(f, 0.0, 1.0, 1e-10, rule);
+    EXPECT_LE(result.error, 1e-10);
+    EXPECT_NEAR(result.value, 2.0 / 3.0, 1e-9);
+    // a fixed rectangle rule needs ~1e7 points for this accuracy
+    EXPECT_LT(result.evaluations, 20000);
+  }
+}
+
+TEST(adaptive_quadrature_tests, check_simpson_split_costs_four_evaluations) {
+  std::int64_t calls = 0;
+  auto f = [&](double x) {
+    calls++;
+    return std::sqrt(x);
+  };
+  auto result = ppc::core::adaptive_integrate(f, 0.0, 1.0, 1e-8, ppc::core::SIMPSON);
+  EXPECT_EQ(result.evaluations, calls);
+  // 5 points for the first interval, the halves of a split reuse 3 of them each
+  EXPECT_GT(calls, 5);
+  EXPECT_EQ((calls - 5) % 4, 0);
+}
+
+TEST(adaptive_quadrature_tests, check_refinement_follows_the_integrand) {
+  // sharp peak at 0.3, flat elsewhere
+  auto peak = [](double x) { return 1.0 / (1e-4 + ((x - 0.3) * (x - 0.3))); };
+  auto result = ppc::core::adaptive_integrate(peak, 0.0, 1.0, 1e-8);
+  double exact = (std::atan(0.7 / 1e-2) + std::atan(0.3 / 1e-2)) / 1e-2;
+  EXPECT_NEAR(result.value, exact, 1e-7);
+}
+
+TEST(adaptive_quadrature_tests, check_budget_stops_singular_integrand) {
+  std::function<double(double)> f = [](double x) { return 1.0 / x; };
+  auto result = ppc::core::adaptive_integrate(f, 0.0, 1.0, 1e-6, ppc::core::GAUSS_KRONROD_15, 3000);
+  EXPECT_GE(result.evaluations, 3000);
+  EXPECT_LT(result.evaluations, 3000 + 30);
+  EXPECT_GT(result.error, 1e-6);
+}
+
+TEST(adaptive_quadrature_tests, check_type_erased_integral) {
+  auto integral = ppc::core::make_adaptive_integral([](double x) { return std::exp(-x * x); }, ppc::core::SIMPSON);
+  auto result = integral(-5.0, 5.0, 1e-9);
+  EXPECT_NEAR(result.value, std::sqrt(M_PI) * std::erf(5.0), 1e-8);
+}
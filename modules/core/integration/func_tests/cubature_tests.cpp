@@ -0,0 +1,111 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include "core/integration/include/cubature.hpp"
+
+namespace {
+
+double cos_product(std::span<const double> x) {
+  double product = 1.0;
+  for (double xi : x) {
+    product *= std::cos(xi);
+  }
+  return product;
+}
+
+}  // namespace
+
+TEST(cubature_tests, check_sobol_first_points) {
+  ppc::core::SobolSequence sobol(3);
+  std::vector<std::uint32_t> x(3);
+  std::vector<std::vector<double>> expected = {
+      {0.0, 0.0, 0.0}, {0.5, 0.5, 0.5}, {0.25, 0.75, 0.75}, {0.75, 0.25, 0.25}, {0.125, 0.625, 0.375}};
+  for (std::uint64_t i = 0; i < expected.size(); i++) {
+    sobol.point(i, x);
+    for (int j = 0; j < 3; j++) {
+      EXPECT_EQ(static_cast<double>(x[j]) * 0x1.0p-32, expected[i][j]) << "point " << i << " dim " << j;
+    }
+  }
+}
+
+TEST(cubature_tests, check_sobol_gray_code_steps) {
+  ppc::core::SobolSequence sobol(8);
+  std::vector<std::uint32_t> stepped(8);
+  std::vector<std::uint32_t> direct(8);
+  sobol.point(0, stepped);
+  for (std::uint64_t n = 1; n < 1000; n++) {
+    sobol.next_gray(n, stepped);
+    sobol.point(n ^ (n >> 1), direct);
+    ASSERT_EQ(stepped, direct);
+  }
+}
+
+TEST(cubature_tests, check_halton_radical_inverse) {
+  EXPECT_DOUBLE_EQ(ppc::core::HaltonSequence::radical_inverse(1, 3), 1.0 / 3);
+  EXPECT_DOUBLE_EQ(ppc::core::HaltonSequence::radical_inverse(2, 3), 2.0 / 3);
+  EXPECT_DOUBLE_EQ(ppc::core::HaltonSequence::radical_inverse(3, 3), 1.0 / 9);
+  EXPECT_DOUBLE_EQ(ppc::core::HaltonSequence::radical_inverse(6, 2), 3.0 / 8);
+}
+
+TEST(cubature_tests, check_tensor_grid) {
+  ppc::core::Cubature grid({0.0, 0.0, 0.0}, {1.0, 2.0, 3.0}, ppc::core::TENSOR_GRID, 40);
+  // multilinear, the midpoint rule is exact
+  auto exact = grid.integrate([](std::span<const double> x) { return x[0] * x[1] * x[2]; });
+  EXPECT_NEAR(exact.value, 0.5 * 2.0 * 4.5, 1e-10);
+  EXPECT_LT(exact.error, 1e-10);
+  EXPECT_EQ(exact.evaluations, (40 * 40 * 40) + (20 * 20 * 20));
+
+  auto smooth = grid.integrate(cos_product);
+  double reference = std::sin(1.0) * std::sin(2.0) * std::sin(3.0);
+  EXPECT_NEAR(smooth.value, reference, 1e-3);
+  EXPECT_LE(std::abs(smooth.value - reference), 2 * smooth.error);
+}
+
+TEST(cubature_tests, check_quasi_monte_carlo_error_estimates) {
+  std::vector<double> lower(6, 0.0);
+  std::vector<double> upper(6, 1.0);
+  double reference = std::pow(std::sin(1.0), 6);
+  for (auto method : {ppc::core::HALTON, ppc::core::SOBOL}) {
+    ppc::core::Cubature qmc(lower, upper, method, 1 << 14, 16, 7);
+    auto result = qmc.integrate(cos_product);
+    EXPECT_EQ(result.evaluations, 16 << 14);
+    EXPECT_LT(result.error, 1e-4);
+    EXPECT_LE(std::abs(result.value - reference), 5 * result.error);
+  }
+}
+
+TEST(cubature_tests, check_items_in_any_order) {
+  ppc::core::Cubature qmc({-1.0, -1.0, -1.0, -1.0}, {1.0, 1.0, 1.0, 1.0}, ppc::core::SOBOL, 10000, 4);
+  auto f = [](std::span<const double> x) { return std::exp(x[0] + x[1] - x[2] * x[3]); };
+  auto in_order = qmc.integrate(f);
+
+  // items split like between ranks, taken backwards
+  std::vector<double> partials(qmc.partial_count());
+  auto items = ppc::core::make_cubature_items(f);
+  for (std::int64_t last = qmc.items(); last > 0; last -= 3) {
+    items(qmc, std::max<std::int64_t>(0, last - 3), last, partials);
+  }
+  auto split = qmc.finish(partials);
+  EXPECT_NEAR(split.value, in_order.value, 1e-12);
+  EXPECT_NEAR(split.error, in_order.error, 1e-12);
+}
+
+TEST(cubature_tests, check_invalid_arguments) {
+  EXPECT_THROW(ppc::core::SobolSequence(9), std::invalid_argument);
+  EXPECT_THROW(ppc::core::Cubature({0.0}, {1.0}, ppc::core::TENSOR_GRID, 3), std::invalid_argument);
+  EXPECT_THROW(ppc::core::Cubature({0.0}, {1.0, 1.0}, ppc::core::HALTON, 100), std::invalid_argument);
+  EXPECT_THROW(ppc::core::Cubature({0.0}, {1.0}, ppc::core::SOBOL, 100, 1), std::invalid_argument);
+  // grids whose size doesn't fit are rejected instead of wrapping around
+  EXPECT_TRUE(ppc::core::Cubature::supports(3, ppc::core::TENSOR_GRID, std::uint64_t{1} << 20));
+  EXPECT_FALSE(ppc::core::Cubature::supports(3, ppc::core::TENSOR_GRID, std::uint64_t{1} << 22));
+  EXPECT_FALSE(ppc::core::Cubature::supports(64, ppc::core::TENSOR_GRID, 2));
+  EXPECT_THROW(ppc::core::Cubature(std::vector<double>(8, 0.0), std::vector<double>(8, 1.0), ppc::core::TENSOR_GRID,
+                                   1 << 10),
+               std::invalid_argument);
+}
@@ -0,0 +1,42 @@
+// Copyright 2024 Nesterov Alexander
+#define _USE_MATH_DEFINES
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <functional>
+
+#include "core/integration/include/integration.hpp"
+
+TEST(integration_tests, check_rectangle_sum_matches_plain_loop) {
+  auto f = [](double x) { return (x * x) + 1.0; };
+  const double a = -1.0;
+  const double h = 0.01;
+  for (double shift : {0.0, 0.5}) {
+    // ranges shorter than a batch and with a tail
+    for (std::int64_t last : {0, 5, 8, 203}) {
+      double expected = 0.0;
+      for (std::int64_t i = 3; i < last; i++) {
+        expected += f(a + (static_cast<double>(i) + shift) * h) * h;
+      }
+      EXPECT_NEAR(ppc::core::rectangle_sum(f, a, h, 3, last, shift), expected, 1e-12);
+    }
+  }
+}
+
+TEST(integration_tests, check_type_erased_integrand) {
+  std::function<double(double)> f = [](double x) { return std::sin(x); };
+  const int n = 1000;
+  double h = M_PI / n;
+  EXPECT_NEAR(ppc::core::rectangle_sum(f, 0.0, h, 0, n, 0.5), 2.0, 1e-5);
+}
+
+TEST(integration_tests, check_range_sums_add_up) {
+  auto sum = ppc::core::make_range_sum([](double x) { return std::exp(x); });
+  const int n = 10000;
+  double h = 1.0 / n;
+  double whole = sum(0.0, h, 0, n);
+  double parts = sum(0.0, h, 0, 1234) + sum(0.0, h, 1234, 5000) + sum(0.0, h, 5000, n);
+  EXPECT_NEAR(whole, parts, 1e-12);
+  EXPECT_NEAR(whole, std::exp(1.0) - 1.0, 1e-3);
+}
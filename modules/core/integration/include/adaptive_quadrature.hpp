@@ -0,0 +1,174 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_ADAPTIVE_QUADRATURE_HPP_
+#define MODULES_CORE_INCLUDE_ADAPTIVE_QUADRATURE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "core/integration/include/integration.hpp"
+
+namespace ppc::core {
+
+struct QuadratureResult {
+  double value = 0.0;
+  // estimate of the absolute error
+  double error = 0.0;
+  std::int64_t evaluations = 0;
+};
+
+enum QuadratureRule {
+  // 5 points per interval, 2 new ones for each half after a split
+  SIMPSON,
+  // 15 points per interval, error from the embedded 7-point Gauss rule
+  GAUSS_KRONROD_15
+};
+
+// Evaluation budget of one adaptive integration, reached only by
+// integrands that don't get smoother under refinement (e.g. singularities).
+inline constexpr std::int64_t kMaxQuadratureEvaluations = 10000000;
+
+// Interval [a, b] with the estimate of a rule on it; `f` keeps the 5
+// Simpson values at a, the quarter points, the midpoint and b, so its
+// halves reuse 3 of them each.
+struct QuadratureInterval {
+  double a;
+  double b;
+  double value;
+  double error;
+  std::array<double, 5> f;
+};
+
+namespace detail {
+
+// Simpson on both halves of [a, b] with Richardson extrapolation, the
+// difference from the whole-interval rule estimates the error
+template <class F>
+QuadratureInterval simpson(const F& f, double a, double b, double fa, double fm, double fb) {
+  double m = (a + b) / 2;
+  double fl = f((a + m) / 2);
+  double fr = f((m + b) / 2);
+  double whole = (b - a) / 6 * (fa + 4 * fm + fb);
+  double halves = (b - a) / 12 * (fa + 4 * fl + 2 * fm + 4 * fr + fb);
+  return {a, b, halves + ((halves - whole) / 15), std::abs(halves - whole) / 15, {fa, fl, fm, fr, fb}};
+}
+
+// nodes, Kronrod and Gauss weights of QUADPACK's qk15 on [-1, 1], the
+// Gauss nodes are the odd ones
+inline constexpr std::array<double, 8> kKronrodNodes = {
+    0.991455371120812639206854697526329, 0.949107912342758524526189684047851, 0.864864423359769072789712788640926,
+    0.741531185599394439863864773280788, 0.586087235467691130294144845693013, 0.405845151377397166906606412076961,
+    0.207784955007898467600689403773245, 0.0};
+inline constexpr std::array<double, 8> kKronrodWeights = {
+    0.022935322010529224963732008058970, 0.063092092629978553290700663189204, 0.104790010322250183839876322541518,
+    0.140653259715525918745189590510238, 0.169004726639267902826583426598550, 0.190350578064785409913256402421014,
+    0.204432940075298892414161999234649, 0.209482141084727828012999174891714};
+inline constexpr std::array<double, 4> kGaussWeights = {
+    0.129484966168869693270611432679082, 0.279705391489276667901467771423780, 0.381830050505118944950369775488975,
+    0.417959183673469387755102040816327};
+
+template <class F>
+QuadratureInterval gauss_kronrod(const F& f, double a, double b) {
+  double center = (a + b) / 2;
+  double half = (b - a) / 2;
+  double fc = f(center);
+  double kronrod = fc * kKronrodWeights[7];
+  double gauss = fc * kGaussWeights[3];
+  for (int j = 0; j < 7; j++) {
+    double dx = half * kKronrodNodes[j];
+    double pair = f(center - dx) + f(center + dx);
+    kronrod += kKronrodWeights[j] * pair;
+    if (j % 2 == 1) {
+      gauss += kGaussWeights[j / 2] * pair;
+    }
+  }
+  return {a, b, kronrod * half, std::abs((kronrod - gauss) * half), {}};
+}
+
+}  // namespace detail
+
+// Globally adaptive integration of f over [a, b]: the interval with the
+// largest error estimate is split in halves until the sum of the estimates
+// is at most `tolerance`, the budget is spent or intervals can't be split
+// any further. Smooth parts of the range stay coarse, evaluations go where
+// the integrand needs them.
+template <Integrand F>
+QuadratureResult adaptive_integrate(const F& f, double a, double b, double tolerance,
+                                    QuadratureRule rule = GAUSS_KRONROD_15,
+                                    std::int64_t max_evaluations = kMaxQuadratureEvaluations) {
+  QuadratureResult result;
+  auto estimate = [&](double lo, double hi, const std::array<double, 3>& known) {
+    if (rule == SIMPSON) {
+      result.evaluations += 2;
+      return detail::simpson(f, lo, hi, known[0], known[1], known[2]);
+    }
+    result.evaluations += 15;
+    return detail::gauss_kronrod(f, lo, hi);
+  };
+  auto by_error = [](const QuadratureInterval& lhs, const QuadratureInterval& rhs) { return lhs.error < rhs.error; };
+
+  std::array<double, 3> ends{};
+  if (rule == SIMPSON) {
+    ends = {f(a), f((a + b) / 2), f(b)};
+    result.evaluations += 3;
+  }
+  std::vector<QuadratureInterval> heap = {estimate(a, b, ends)};
+  // running sum of the estimates, compensated: it falls by many orders of
+  // magnitude and plain rounding would keep it above the tolerance
+  double error = heap.front().error;
+  double compensation = 0.0;
+  auto add_error = [&](double term) {
+    double sum = error + term;
+    compensation += std::abs(error) >= std::abs(term) ? (error - sum) + term : (term - sum) + error;
+    error = sum;
+  };
+  while (error + compensation > tolerance && result.evaluations < max_evaluations) {
+    std::pop_heap(heap.begin(), heap.end(), by_error);
+    QuadratureInterval worst = heap.back();
+    heap.pop_back();
+    double m = (worst.a + worst.b) / 2;
+    if (!(worst.a < m && m < worst.b)) {
+      // no representable midpoint, keep the interval as it is
+      heap.push_back(worst);
+      std::push_heap(heap.begin(), heap.end(), by_error);
+      break;
+    }
+    // the midpoints of the halves were the quarter points of the parent
+    auto left = estimate(worst.a, m, {worst.f[0], worst.f[1], worst.f[2]});
+    auto right = estimate(m, worst.b, {worst.f[2], worst.f[3], worst.f[4]});
+    add_error(-worst.error);
+    add_error(left.error);
+    add_error(right.error);
+    for (const auto& half : {left, right}) {
+      heap.push_back(half);
+      std::push_heap(heap.begin(), heap.end(), by_error);
+    }
+  }
+  // sums from scratch, the running error only decided when to stop
+  for (const auto& interval : heap) {
+    result.value += interval.value;
+    result.error += interval.error;
+  }
+  return result;
+}
+
+// Adaptive integration behind a single type-erased call, like RangeSum:
+// the integrand is inlined into the rule.
+using AdaptiveIntegral = std::function<QuadratureResult(double a, double b, double tolerance)>;
+
+template <Integrand F>
+AdaptiveIntegral make_adaptive_integral(F f, QuadratureRule rule = GAUSS_KRONROD_15,
+                                        std::int64_t max_evaluations = kMaxQuadratureEvaluations) {
+  return [f = std::move(f), rule, max_evaluations](double a, double b, double tolerance) {
+    return adaptive_integrate(f, a, b, tolerance, rule, max_evaluations);
+  };
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_ADAPTIVE_QUADRATURE_HPP_
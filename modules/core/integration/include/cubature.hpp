@@ -0,0 +1,365 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_CUBATURE_HPP_
+#define MODULES_CORE_INCLUDE_CUBATURE_HPP_
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/generator/include/generator.hpp"
+#include "core/integration/include/adaptive_quadrature.hpp"
+
+namespace ppc::core {
+
+template <class F>
+concept MultiIntegrand = std::invocable<F&, std::span<const double>> &&
+                         std::convertible_to<std::invoke_result_t<F&, std::span<const double>>, double>;
+
+// Sobol points with the direction numbers of Joe and Kuo (new-joe-kuo-6.21201)
+// for the first kMaxDims dimensions; coordinates are 32-bit fractions.
+class SobolSequence {
+ public:
+  static constexpr int kMaxDims = 8;
+
+  explicit SobolSequence(int dims) : directions_(dims) {
+    if (dims < 1 || dims > kMaxDims) {
+      throw std::invalid_argument("SobolSequence supports 1 to 8 dimensions");
+    }
+    // degree s, coefficients a and initial m_1..m_s of the primitive
+    // polynomial of dimensions 2..8
+    struct Polynomial {
+      int s;
+      std::uint32_t a;
+      std::array<std::uint32_t, 5> m;
+    };
+    static constexpr std::array<Polynomial, kMaxDims - 1> kPolynomials = {{{1, 0, {1}},
+                                                                          {2, 1, {1, 3}},
+                                                                          {3, 1, {1, 3, 1}},
+                                                                          {3, 2, {1, 1, 1}},
+                                                                          {4, 1, {1, 1, 3, 3}},
+                                                                          {4, 4, {1, 3, 5, 13}},
+                                                                          {5, 2, {1, 1, 5, 5, 17}}}};
+    for (int k = 0; k < 32; k++) {
+      directions_[0][k] = 1U << (31 - k);
+    }
+    for (int j = 1; j < dims; j++) {
+      const auto& p = kPolynomials[j - 1];
+      auto& v = directions_[j];
+      for (int k = 0; k < p.s; k++) {
+        v[k] = p.m[k] << (31 - k);
+      }
+      for (int k = p.s; k < 32; k++) {
+        v[k] = v[k - p.s] ^ (v[k - p.s] >> p.s);
+        for (int l = 1; l < p.s; l++) {
+          v[k] ^= ((p.a >> (p.s - 1 - l)) & 1U) * v[k - l];
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] int dims() const { return static_cast<int>(directions_.size()); }
+
+  // point `index` (below 2^32)
+  void point(std::uint64_t index, std::span<std::uint32_t> x) const {
+    std::fill(x.begin(), x.end(), 0U);
+    for (int k = 0; index != 0; k++, index >>= 1) {
+      if ((index & 1U) != 0) {
+        for (int j = 0; j < dims(); j++) {
+          x[j] ^= directions_[j][k];
+        }
+      }
+    }
+  }
+
+  // moves x from the point gray(n - 1) to gray(n), where gray(n) = n ^ (n >> 1):
+  // a single XOR per coordinate instead of one per bit of the index
+  void next_gray(std::uint64_t n, std::span<std::uint32_t> x) const {
+    int k = std::countr_zero(n);
+    for (int j = 0; j < dims(); j++) {
+      x[j] ^= directions_[j][k];
+    }
+  }
+
+ private:
+  std::vector<std::array<std::uint32_t, 32>> directions_;
+};
+
+// Halton points: coordinate j of point i is the radical inverse of i in
+// the j-th prime base.
+class HaltonSequence {
+ public:
+  static constexpr std::array<int, 16> kBases = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53};
+  static constexpr int kMaxDims = static_cast<int>(kBases.size());
+
+  explicit HaltonSequence(int dims) : dims_(dims) {
+    if (dims < 1 || dims > kMaxDims) {
+      throw std::invalid_argument("HaltonSequence supports 1 to 16 dimensions");
+    }
+  }
+
+  static double radical_inverse(std::uint64_t index, int base) {
+    double inverse = 1.0 / base;
+    double digit_weight = inverse;
+    double value = 0.0;
+    for (; index != 0; index /= base, digit_weight *= inverse) {
+      value += static_cast<double>(index % base) * digit_weight;
+    }
+    return value;
+  }
+
+  void point(std::uint64_t index, std::span<double> x) const {
+    for (int j = 0; j < dims_; j++) {
+      x[j] = radical_inverse(index, kBases[j]);
+    }
+  }
+
+ private:
+  int dims_;
+};
+
+enum CubatureMethod {
+  // midpoints of an n^d grid, error from the (n/2)^d grid; low dimensions only
+  TENSOR_GRID,
+  // randomized quasi-Monte Carlo: independent replicas of the point set
+  // (random shift for Halton, random digital shift for Sobol), the error
+  // is the standard error of the replica means
+  HALTON,
+  SOBOL
+};
+
+// Integral of f over the box [lower, upper] split into independent work
+// items. Every item adds its sums to a few partials, the partials of all
+// items summed in any order (one vector reduction for all ranks) give the
+// value and its error estimate. Items are blocks of grid indices or of the
+// points of one replica, so ranks and threads may take them in any way
+// and the result doesn't depend on how many there are.
+class Cubature {
+ public:
+  static constexpr std::uint64_t kBlock = 4096;
+
+  // `points` is the number of points per dimension (even) for TENSOR_GRID
+  // and the number of points of every replica for HALTON and SOBOL
+  Cubature(std::vector<double> lower, std::vector<double> upper, CubatureMethod method, std::uint64_t points,
+           int replicas = 16, std::uint64_t seed = 0)
+      : lower_(std::move(lower)), upper_(std::move(upper)), method_(method), points_(points), replicas_(replicas) {
+    if (lower_.size() != upper_.size() || !supports(lower_.size(), method_, points_, replicas_)) {
+      throw std::invalid_argument("Cubature: unsupported dimensions, points or replicas");
+    }
+    if (method_ == TENSOR_GRID) {
+      fine_points_ = *grid_size(lower_.size(), points_);
+      coarse_points_ = *grid_size(lower_.size(), points_ / 2);
+      replicas_ = 1;
+    } else {
+      if (method_ == SOBOL) {
+        sobol_.emplace(dims());
+      } else {
+        halton_.emplace(dims());
+      }
+      // independent randomization of every replica
+      CounterGenerator<std::uint32_t> digits(seed, 0, UINT32_MAX);
+      CounterGenerator<double> offsets(seed, 0.0, 1.0);
+      for (std::uint64_t i = 0; i < static_cast<std::uint64_t>(replicas_) * dims(); i++) {
+        digital_shifts_.push_back(digits(i));
+        shifts_.push_back(offsets(i));
+      }
+    }
+  }
+
+  // whether the arguments are valid for the constructor, e.g. for validation() of a task
+  static bool supports(std::size_t dims, CubatureMethod method, std::uint64_t points, int replicas = 16) {
+    switch (method) {
+      case TENSOR_GRID:
+        return dims >= 1 && points >= 2 && points % 2 == 0 && grid_size(dims, points).has_value();
+      case SOBOL:
+        return dims >= 1 && dims <= SobolSequence::kMaxDims && points >= 1 && points <= (std::uint64_t{1} << 32) &&
+               replicas >= 2;
+      default:
+        return dims >= 1 && dims <= HaltonSequence::kMaxDims && points >= 1 && replicas >= 2;
+    }
+  }
+
+  [[nodiscard]] int dims() const { return static_cast<int>(lower_.size()); }
+
+  [[nodiscard]] std::int64_t items() const {
+    if (method_ == TENSOR_GRID) {
+      return blocks(fine_points_) + blocks(coarse_points_);
+    }
+    return replicas_ * blocks(points_);
+  }
+
+  // fine and coarse grid sums, or one sum per replica
+  [[nodiscard]] std::size_t partial_count() const { return method_ == TENSOR_GRID ? 2 : replicas_; }
+
+  // adds the sums of `item` to `partials` (partial_count() elements)
+  template <MultiIntegrand F>
+  void add_item(const F& f, std::int64_t item, std::span<double> partials) const {
+    std::vector<double> x(dims());
+    if (method_ == TENSOR_GRID) {
+      bool fine = item < blocks(fine_points_);
+      std::uint64_t n = fine ? points_ : points_ / 2;
+      std::uint64_t total = fine ? fine_points_ : coarse_points_;
+      std::uint64_t first = (fine ? item : item - blocks(fine_points_)) * kBlock;
+      partials[fine ? 0 : 1] += grid_sum(f, n, first, std::min(total, first + kBlock), x);
+      return;
+    }
+    std::int64_t replica = item / blocks(points_);
+    std::uint64_t first = (item % blocks(points_)) * kBlock;
+    std::uint64_t last = std::min(points_, first + kBlock);
+    partials[replica] +=
+        method_ == SOBOL ? sobol_sum(f, replica, first, last, x) : halton_sum(f, replica, first, last, x);
+  }
+
+  // value, error estimate and evaluations from the partials of all items
+  [[nodiscard]] QuadratureResult finish(std::span<const double> partials) const {
+    double volume = 1.0;
+    for (int j = 0; j < dims(); j++) {
+      volume *= upper_[j] - lower_[j];
+    }
+    if (method_ == TENSOR_GRID) {
+      double fine = volume * partials[0] / static_cast<double>(fine_points_);
+      double coarse = volume * partials[1] / static_cast<double>(coarse_points_);
+      // the midpoint rule is second order, halving h cuts the error by 4
+      return {fine, std::abs(fine - coarse) / 3, static_cast<std::int64_t>(fine_points_ + coarse_points_)};
+    }
+    double mean = 0.0;
+    for (int r = 0; r < replicas_; r++) {
+      mean += volume * partials[r] / static_cast<double>(points_);
+    }
+    mean /= replicas_;
+    double variance = 0.0;
+    for (int r = 0; r < replicas_; r++) {
+      double deviation = (volume * partials[r] / static_cast<double>(points_)) - mean;
+      variance += deviation * deviation;
+    }
+    variance /= replicas_ - 1;
+    return {mean, std::sqrt(variance / replicas_), static_cast<std::int64_t>(points_) * replicas_};
+  }
+
+  // all items on the calling thread
+  template <MultiIntegrand F>
+  QuadratureResult integrate(const F& f) const {
+    std::vector<double> partials(partial_count());
+    for (std::int64_t item = 0; item < items(); item++) {
+      add_item(f, item, partials);
+    }
+    return finish(partials);
+  }
+
+ private:
+  static std::int64_t blocks(std::uint64_t count) { return static_cast<std::int64_t>((count + kBlock - 1) / kBlock); }
+
+  // n^dims, none if the fine and coarse grids together don't fit the int64
+  // count of evaluations
+  static std::optional<std::uint64_t> grid_size(std::size_t dims, std::uint64_t n) {
+    constexpr std::uint64_t kMaxGrid = std::uint64_t{1} << 62;
+    std::uint64_t size = 1;
+    for (std::size_t j = 0; j < dims; j++) {
+      if (size > kMaxGrid / n) {
+        return std::nullopt;
+      }
+      size *= n;
+    }
+    return size;
+  }
+
+  void map(std::span<double> x) const {
+    for (int j = 0; j < dims(); j++) {
+      x[j] = lower_[j] + (x[j] * (upper_[j] - lower_[j]));
+    }
+  }
+
+  template <class F>
+  double grid_sum(const F& f, std::uint64_t n, std::uint64_t first, std::uint64_t last, std::vector<double>& x) const {
+    double sum = 0.0;
+    for (std::uint64_t i = first; i < last; i++) {
+      std::uint64_t rest = i;
+      for (int j = dims() - 1; j >= 0; j--) {
+        x[j] = (static_cast<double>(rest % n) + 0.5) / static_cast<double>(n);
+        rest /= n;
+      }
+      map(x);
+      sum += f(std::span<const double>(x));
+    }
+    return sum;
+  }
+
+  // points in Gray code order: gray(i) for i in [first, last)
+  template <class F>
+  double sobol_sum(const F& f, std::int64_t replica, std::uint64_t first, std::uint64_t last,
+                   std::vector<double>& x) const {
+    const auto& sobol = *sobol_;
+    std::vector<std::uint32_t> bits(dims());
+    sobol.point(first ^ (first >> 1), bits);
+    double sum = 0.0;
+    for (std::uint64_t i = first; i < last; i++) {
+      if (i != first) {
+        sobol.next_gray(i, bits);
+      }
+      for (int j = 0; j < dims(); j++) {
+        x[j] = static_cast<double>(bits[j] ^ digital_shifts_[(replica * dims()) + j]) * 0x1.0p-32;
+      }
+      map(x);
+      sum += f(std::span<const double>(x));
+    }
+    return sum;
+  }
+
+  template <class F>
+  double halton_sum(const F& f, std::int64_t replica, std::uint64_t first, std::uint64_t last,
+                    std::vector<double>& x) const {
+    double sum = 0.0;
+    for (std::uint64_t i = first; i < last; i++) {
+      halton_->point(i, x);
+      for (int j = 0; j < dims(); j++) {
+        x[j] += shifts_[(replica * dims()) + j];
+        x[j] -= std::floor(x[j]);
+      }
+      map(x);
+      sum += f(std::span<const double>(x));
+    }
+    return sum;
+  }
+
+  std::vector<double> lower_;
+  std::vector<double> upper_;
+  CubatureMethod method_;
+  std::uint64_t points_;
+  int replicas_;
+  std::uint64_t fine_points_{};
+  std::uint64_t coarse_points_{};
+  std::optional<SobolSequence> sobol_;
+  std::optional<HaltonSequence> halton_;
+  std::vector<std::uint32_t> digital_shifts_;
+  std::vector<double> shifts_;
+};
+
+// Cubature over the whole item range behind one type-erased call, like
+// RangeSum: f is inlined into the point loops of the items.
+using CubatureItems = std::function<void(const Cubature& cubature, std::int64_t first, std::int64_t last,
+                                         std::span<double> partials)>;
+
+template <MultiIntegrand F>
+CubatureItems make_cubature_items(F f) {
+  return [f = std::move(f)](const Cubature& cubature, std::int64_t first, std::int64_t last,
+                            std::span<double> partials) {
+    for (auto item = first; item < last; item++) {
+      cubature.add_item(f, item, partials);
+    }
+  };
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_CUBATURE_HPP_
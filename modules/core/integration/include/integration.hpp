@@ -0,0 +1,62 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_INTEGRATION_HPP_
+#define MODULES_CORE_INCLUDE_INTEGRATION_HPP_
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace ppc::core {
+
+// Integrand evaluated in batches of this many points with one accumulator
+// per lane: a full AVX-512 vector of doubles or two AVX2 ones.
+inline constexpr int kIntegrationBatch = 8;
+
+template <class F>
+concept Integrand = std::invocable<F&, double> && std::convertible_to<std::invoke_result_t<F&, double>, double>;
+
+// Rectangle sum h * sum of f(a + (i + shift) * h) over i in [first, last):
+// shift = 0 gives left rectangles, shift = 0.5 midpoints. With a lambda or
+// functor `f` is inlined into the batch loop, so the compiler vectorizes
+// the evaluation; a std::function still works, with an indirect call per
+// point.
+template <Integrand F>
+double rectangle_sum(const F& f, double a, double h, std::int64_t first, std::int64_t last, double shift = 0.0) {
+  std::array<double, kIntegrationBatch> lanes{};
+  std::int64_t i = first;
+  for (; i + kIntegrationBatch <= last; i += kIntegrationBatch) {
+    auto base = static_cast<double>(i) + shift;
+    for (int k = 0; k < kIntegrationBatch; k++) {
+      lanes[k] += f(a + (base + k) * h);
+    }
+  }
+  double sum = 0.0;
+  for (double lane : lanes) {
+    sum += lane;
+  }
+  for (; i < last; i++) {
+    sum += f(a + (static_cast<double>(i) + shift) * h);
+  }
+  return sum * h;
+}
+
+// Rectangle sum over [first, last) behind a single type-erased call: the
+// integrand is captured by value and inlined into the sum, so a task can
+// hold any integrand and pay for the indirection once per range, not once
+// per point.
+using RangeSum = std::function<double(double a, double h, std::int64_t first, std::int64_t last)>;
+
+template <Integrand F>
+RangeSum make_range_sum(F f, double shift = 0.0) {
+  return [f = std::move(f), shift](double a, double h, std::int64_t first, std::int64_t last) {
+    return rectangle_sum(f, a, h, first, last, shift);
+  };
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_INTEGRATION_HPP_
@@ -0,0 +1,107 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "core/matrix/include/matrix.hpp"
+#include "core/task/include/task.hpp"
+
+TEST(matrix_tests, check_owning_rows_are_aligned_and_padded) {
+  ppc::core::Matrix<int> matrix(5, 7);
+  EXPECT_TRUE(matrix.owns());
+  EXPECT_EQ(matrix.ld(), ppc::core::kMatrixAlignment / sizeof(int));
+  for (std::size_t i = 0; i < matrix.rows(); i++) {
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(matrix.row(i).data()) % ppc::core::kMatrixAlignment, 0U);
+    for (std::size_t j = 0; j < matrix.cols(); j++) {
+      EXPECT_EQ(matrix(i, j), 0);
+      matrix(i, j) = static_cast<int>((i * 10) + j);
+    }
+  }
+  EXPECT_EQ(matrix.row(3)[4], 34);
+  EXPECT_EQ(matrix.row(3).size(), 7U);
+  auto column = matrix.col(2);
+  ASSERT_EQ(column.size(), 5U);
+  EXPECT_EQ(column[4], 42);
+}
+
+TEST(matrix_tests, check_tile_is_a_view) {
+  ppc::core::Matrix<double> matrix(6, 6);
+  auto tile = matrix.tile(2, 3, 2, 3);
+  EXPECT_FALSE(tile.owns());
+  EXPECT_EQ(tile.ld(), matrix.ld());
+  tile(1, 2) = 1.5;
+  EXPECT_EQ(matrix(3, 5), 1.5);
+
+  const auto& constant = matrix;
+  EXPECT_EQ(constant.tile(3, 5, 1, 1)(0, 0), 1.5);
+}
+
+TEST(matrix_tests, check_copies) {
+  ppc::core::Matrix<int> matrix(2, 3);
+  matrix(1, 1) = 4;
+  ppc::core::Matrix<int> copy = matrix;
+  EXPECT_TRUE(copy.owns());
+  EXPECT_NE(copy.data(), matrix.data());
+  copy(1, 1) = 5;
+  EXPECT_EQ(matrix(1, 1), 4);
+
+  // a copy of a view refers to the same elements
+  auto view = ppc::core::Matrix<int>::view(matrix.data(), 2, 3, matrix.ld());
+  ppc::core::Matrix<int> view_copy = view;
+  view_copy(1, 1) = 6;
+  EXPECT_EQ(matrix(1, 1), 6);
+
+  ppc::core::Matrix<int> moved = std::move(copy);
+  EXPECT_TRUE(moved.owns());
+  EXPECT_EQ(moved(1, 1), 5);
+}
+
+TEST(matrix_tests, check_rows_in_one_buffer_are_not_copied) {
+  const std::size_t rows = 4;
+  const std::size_t cols = 3;
+  std::vector<int> buffer(rows * cols);
+  std::iota(buffer.begin(), buffer.end(), 0);
+  ppc::core::TaskData taskData;
+  for (std::size_t i = 0; i < rows; i++) {
+    taskData.inputs.emplace_back(reinterpret_cast<uint8_t *>(buffer.data() + (i * cols)));
+  }
+
+  auto matrix = ppc::core::matrix_from_rows<int>(taskData, rows, cols);
+  EXPECT_FALSE(matrix.owns());
+  EXPECT_EQ(matrix.data(), buffer.data());
+  EXPECT_EQ(matrix.ld(), cols);
+  EXPECT_EQ(matrix(2, 1), 7);
+}
+
+TEST(matrix_tests, check_separate_rows_are_copied_once) {
+  std::vector<std::vector<int>> rows = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}};
+  ppc::core::TaskData taskData;
+  taskData.inputs.emplace_back(nullptr);
+  for (auto &row : rows) {
+    taskData.inputs.emplace_back(reinterpret_cast<uint8_t *>(row.data()));
+  }
+
+  auto matrix = ppc::core::matrix_from_rows<int>(taskData, rows.size(), 3, 1);
+  EXPECT_TRUE(matrix.owns());
+  for (std::size_t i = 0; i < rows.size(); i++) {
+    for (std::size_t j = 0; j < 3; j++) {
+      EXPECT_EQ(matrix(i, j), rows[i][j]);
+    }
+  }
+}
+
+TEST(matrix_tests, check_matrix_from_single_input) {
+  std::vector<float> buffer(3 * 5);
+  std::iota(buffer.begin(), buffer.end(), 0.0F);
+  ppc::core::TaskData taskData;
+  taskData.inputs.emplace_back(reinterpret_cast<uint8_t *>(buffer.data()));
+
+  auto padded = ppc::core::matrix_from_input<float>(taskData, 0, 3, 4, 5);
+  EXPECT_EQ(padded(2, 3), 13.0F);
+  auto dense = ppc::core::matrix_from_input<float>(taskData, 0, 5, 3);
+  EXPECT_EQ(dense(4, 2), 14.0F);
+}
@@ -0,0 +1,185 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_MATRIX_HPP_
+#define MODULES_CORE_INCLUDE_MATRIX_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc::core {
+
+// Alignment of the rows of an owning Matrix: a cache line, and a full
+// AVX-512 register.
+inline constexpr std::size_t kMatrixAlignment = 64;
+
+// Allocator of kMatrixAlignment-aligned storage for std::vector.
+template <class T>
+struct AlignedAllocator {
+  using value_type = T;
+
+  [[nodiscard]] T* allocate(std::size_t n) {
+    return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{kMatrixAlignment}));
+  }
+  void deallocate(T* p, std::size_t /*n*/) { ::operator delete(p, std::align_val_t{kMatrixAlignment}); }
+
+  bool operator==(const AlignedAllocator&) const = default;
+};
+
+// `size` elements `stride` apart, e.g. a column of a Matrix.
+template <class T>
+class StridedSpan {
+ public:
+  StridedSpan(T* data, std::size_t size, std::size_t stride) : data_(data), size_(size), stride_(stride) {}
+
+  [[nodiscard]] std::size_t size() const { return size_; }
+  [[nodiscard]] std::size_t stride() const { return stride_; }
+  T& operator[](std::size_t i) const { return data_[i * stride_]; }
+
+ private:
+  T* data_;
+  std::size_t size_;
+  std::size_t stride_;
+};
+
+// Row-major rows x cols matrix with rows ld() elements apart. An owning
+// matrix keeps its elements in one allocation with every row starting on
+// kMatrixAlignment (ld is cols rounded up to the alignment), so rows can be
+// processed with aligned vector loads and one kernel call can run over
+// many rows. A view shares someone else's elements; copying a view copies
+// the reference, copying an owning matrix copies the elements.
+template <class T>
+class Matrix {
+ public:
+  Matrix() = default;
+
+  // owning, value-initialized
+  Matrix(std::size_t rows, std::size_t cols)
+    requires(!std::is_const_v<T>)
+      : rows_(rows), cols_(cols), ld_(padded_ld(cols)), storage_(rows * ld_), data_(storage_.data()) {}
+
+  static Matrix view(T* data, std::size_t rows, std::size_t cols, std::size_t ld) {
+    Matrix matrix;
+    matrix.rows_ = rows;
+    matrix.cols_ = cols;
+    matrix.ld_ = ld;
+    matrix.data_ = data;
+    return matrix;
+  }
+
+  Matrix(const Matrix& other)
+      : rows_(other.rows_),
+        cols_(other.cols_),
+        ld_(other.ld_),
+        storage_(other.storage_),
+        data_(other.owns() ? storage_.data() : other.data_) {}
+  Matrix(Matrix&& other) noexcept
+      : rows_(std::exchange(other.rows_, 0)),
+        cols_(std::exchange(other.cols_, 0)),
+        ld_(std::exchange(other.ld_, 0)),
+        storage_(std::move(other.storage_)),
+        data_(std::exchange(other.data_, nullptr)) {}
+  Matrix& operator=(Matrix other) noexcept {
+    std::swap(rows_, other.rows_);
+    std::swap(cols_, other.cols_);
+    std::swap(ld_, other.ld_);
+    std::swap(storage_, other.storage_);
+    std::swap(data_, other.data_);
+    return *this;
+  }
+  ~Matrix() = default;
+
+  [[nodiscard]] std::size_t rows() const { return rows_; }
+  [[nodiscard]] std::size_t cols() const { return cols_; }
+  [[nodiscard]] std::size_t ld() const { return ld_; }
+  [[nodiscard]] bool empty() const { return rows_ == 0 || cols_ == 0; }
+  [[nodiscard]] bool owns() const { return data_ != nullptr && data_ == storage_.data(); }
+
+  T* data() { return data_; }
+  const T* data() const { return data_; }
+
+  T& operator()(std::size_t i, std::size_t j) { return data_[(i * ld_) + j]; }
+  const T& operator()(std::size_t i, std::size_t j) const { return data_[(i * ld_) + j]; }
+
+  std::span<T> row(std::size_t i) { return {data_ + (i * ld_), cols_}; }
+  std::span<const T> row(std::size_t i) const { return {data_ + (i * ld_), cols_}; }
+
+  StridedSpan<T> col(std::size_t j) { return {data_ + j, rows_, ld_}; }
+  StridedSpan<const T> col(std::size_t j) const { return {data_ + j, rows_, ld_}; }
+
+  // view of rows [row, row + rows) and columns [col, col + cols)
+  Matrix tile(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) {
+    return view(data_ + (row * ld_) + col, rows, cols, ld_);
+  }
+  Matrix<const T> tile(std::size_t row, std::size_t col, std::size_t rows, std::size_t cols) const {
+    return Matrix<const T>::view(data_ + (row * ld_) + col, rows, cols, ld_);
+  }
+
+  Matrix<const T> view() const { return Matrix<const T>::view(data_, rows_, cols_, ld_); }
+
+  static std::size_t padded_ld(std::size_t cols) {
+    if constexpr (kMatrixAlignment % sizeof(T) == 0) {
+      constexpr std::size_t kStep = kMatrixAlignment / sizeof(T);
+      return (cols + kStep - 1) / kStep * kStep;
+    } else {
+      return cols;
+    }
+  }
+
+ private:
+  std::size_t rows_{};
+  std::size_t cols_{};
+  std::size_t ld_{};
+  std::vector<std::remove_const_t<T>, AlignedAllocator<std::remove_const_t<T>>> storage_;
+  T* data_{};
+};
+
+// Matrix over a rows x cols matrix passed as one pointer per row in
+// taskData.inputs[first, first + rows). Rows that already lie back to back
+// (pointers into one buffer) are used in place, other rows are copied once
+// into an owning matrix. Either way data() is followed by rows * ld()
+// elements, so the result can be split into blocks of whole rows.
+template <class T>
+Matrix<T> matrix_from_rows(const TaskData& taskData, std::size_t rows, std::size_t cols, std::size_t first = 0) {
+  auto row = [&](std::size_t i) { return reinterpret_cast<T*>(taskData.inputs[first + i]); };
+  if (rows == 0) {
+    return Matrix<T>(0, cols);
+  }
+  auto base = reinterpret_cast<std::uintptr_t>(row(0));
+  bool contiguous = true;
+  for (std::size_t i = 1; i < rows && contiguous; i++) {
+    contiguous = reinterpret_cast<std::uintptr_t>(row(i)) == base + (i * cols * sizeof(T));
+  }
+  if (contiguous) {
+    return Matrix<T>::view(row(0), rows, cols, cols);
+  }
+  Matrix<T> matrix(rows, cols);
+  for (std::size_t i = 0; i < rows; i++) {
+    std::copy_n(row(i), cols, matrix.row(i).begin());
+  }
+  return matrix;
+}
+
+// View of a whole row-major matrix passed as taskData.inputs[index], rows
+// `ld` elements apart.
+template <class T>
+Matrix<T> matrix_from_input(const TaskData& taskData, std::size_t index, std::size_t rows, std::size_t cols,
+                            std::size_t ld) {
+  return Matrix<T>::view(reinterpret_cast<T*>(taskData.inputs[index]), rows, cols, ld);
+}
+
+template <class T>
+Matrix<T> matrix_from_input(const TaskData& taskData, std::size_t index, std::size_t rows, std::size_t cols) {
+  return matrix_from_input<T>(taskData, index, rows, cols, cols);
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_MATRIX_HPP_
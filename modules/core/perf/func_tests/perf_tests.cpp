@@ -155,3 +155,50 @@ TEST(perf_tests, check_perf_task_float) {
   ASSERT_LE(perfResults->time_sec, 10.0);
   EXPECT_EQ(out[0], in.size());
 }
+
+TEST(perf_tests, check_perf_hooks) {
+  // Create data
+  std::vector<uint32_t> in(100, 1);
+  std::vector<uint32_t> out(1, 0);
+
+  // Create TaskData
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskData->inputs_count.emplace_back(in.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  int begins = 0;
+  int ends = 0;
+  auto handle = ppc::core::Perf::add_hooks([&] { begins++; },
+                                           [&](ppc::core::PerfResults &perfResults) {
+                                             ends++;
+                                             perfResults.counters["last_phase_is_run"] =
+                                                 ppc::core::Task::current_phase() == "run";
+                                           });
+
+  // Create Task
+  auto testTask = std::make_shared<ppc::test::TestTask<uint32_t>>(taskData);
+
+  // Create Perf attributes
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 5;
+
+  // Create and init perf results
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  ppc::core::Perf perfAnalyzer(testTask);
+  perfAnalyzer.task_run(perfAttr, perfResults);
+
+  EXPECT_EQ(begins, 1);
+  EXPECT_EQ(ends, 1);
+  EXPECT_EQ(perfResults->counters["last_phase_is_run"], 1.0);
+
+  // removed hooks are not called by later runs
+  ppc::core::Perf::remove_hooks(handle);
+  auto laterResults = std::make_shared<ppc::core::PerfResults>();
+  perfAnalyzer.task_run(perfAttr, laterResults);
+  EXPECT_EQ(begins, 1);
+  EXPECT_TRUE(laterResults->counters.empty());
+}
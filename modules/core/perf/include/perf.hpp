@@ -3,9 +3,13 @@
 #ifndef MODULES_CORE_INCLUDE_PERF_HPP_
 #define MODULES_CORE_INCLUDE_PERF_HPP_
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -24,6 +28,8 @@ struct PerfResults {
   double time_sec = 0.0;
   enum TypeOfRunning { PIPELINE, TASK_RUN, NONE } type_of_running = NONE;
   constexpr const static double MAX_TIME = 10.0;
+  // additional statistics of the measured runs, e.g. from a profiler
+  std::map<std::string, double> counters;
 };
 
 class Perf {
@@ -41,11 +47,20 @@ class Perf {
   void task_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::shared_ptr<ppc::core::PerfResults>& perfResults);
   // Pint results for automation checkers
   static void print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults);
+  // Add hooks called before and after the measured runs of every Perf,
+  // `on_end` may add its statistics to PerfResults::counters. Returns the
+  // handle to remove them with.
+  static std::size_t add_hooks(std::function<void()> on_begin, std::function<void(PerfResults&)> on_end);
+  // Remove the hooks added with `handle`
+  static void remove_hooks(std::size_t handle);
 
  private:
   std::shared_ptr<Task> task;
   static void common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
                          const std::shared_ptr<ppc::core::PerfResults>& perfResults);
+  using Hook = std::pair<std::function<void()>, std::function<void(PerfResults&)>>;
+  // by handle, so they run in the order they were added
+  static std::map<std::size_t, Hook>& hooks();
 };
 
 }  // namespace core
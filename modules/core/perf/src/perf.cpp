@@ -47,12 +47,31 @@ void ppc::core::Perf::task_run(const std::shared_ptr<PerfAttr>& perfAttr,
 
 void ppc::core::Perf::common_run(const std::shared_ptr<PerfAttr>& perfAttr, const std::function<void()>& pipeline,
                                  const std::shared_ptr<ppc::core::PerfResults>& perfResults) {
+  for (auto& [handle, hook] : hooks()) {
+    hook.first();
+  }
   auto begin = perfAttr->current_timer();
   for (uint64_t i = 0; i < perfAttr->num_running; i++) {
     pipeline();
   }
   auto end = perfAttr->current_timer();
   perfResults->time_sec = end - begin;
+  for (auto& [handle, hook] : hooks()) {
+    hook.second(*perfResults);
+  }
+}
+
+std::size_t ppc::core::Perf::add_hooks(std::function<void()> on_begin, std::function<void(PerfResults&)> on_end) {
+  static std::size_t next_handle = 0;
+  hooks().emplace(next_handle, Hook(std::move(on_begin), std::move(on_end)));
+  return next_handle++;
+}
+
+void ppc::core::Perf::remove_hooks(std::size_t handle) { hooks().erase(handle); }
+
+std::map<std::size_t, ppc::core::Perf::Hook>& ppc::core::Perf::hooks() {
+  static std::map<std::size_t, Hook> all;
+  return all;
 }
 
 void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& perfResults) {
@@ -89,4 +108,8 @@ void ppc::core::Perf::print_perf_statistic(const std::shared_ptr<PerfResults>& p
   }
 
   std::cout << relative_path << ":" << type_test_name << ":" << perf_res_str.str() << std::endl;
+  for (const auto& [name, value] : perfResults->counters) {
+    std::cout << relative_path << ":" << type_test_name << ":counter:" << name << "=" << std::setprecision(15) << value
+              << std::endl;
+  }
 }
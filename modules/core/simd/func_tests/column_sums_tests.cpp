@@ -0,0 +1,32 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "core/simd/include/column_sums.hpp"
+
+TEST(column_sums_tests, check_sums_across_strips_with_padding) {
+  // wider than one strip of ints and rows padded to `ld`
+  const std::size_t rows = 5;
+  const std::size_t cols = (ppc::core::kColumnStripBytes / sizeof(int)) + 9;
+  const std::size_t ld = cols + 2;
+  std::vector<int> matrix(rows * ld, -100);
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      matrix[(i * ld) + j] = static_cast<int>((i * 7) + (j % 13));
+    }
+  }
+  std::vector<int> out(cols, 1);
+  ppc::core::add_column_sums(matrix.data(), rows, cols, ld, out.data());
+  for (std::size_t j = 0; j < cols; j++) {
+    // 1 + sum over i of 7i + j % 13
+    EXPECT_EQ(out[j], static_cast<int>(1 + 70 + (5 * (j % 13)))) << j;
+  }
+}
+
+TEST(column_sums_tests, check_empty_matrix) {
+  std::vector<double> out(3, 2.5);
+  ppc::core::add_column_sums<double>(nullptr, 0, 3, 3, out.data());
+  EXPECT_EQ(out, std::vector<double>(3, 2.5));
+}
@@ -0,0 +1,126 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "core/simd/include/dot_product.hpp"
+
+namespace {
+
+std::int64_t reference_dot(const std::vector<std::int32_t>& a, const std::vector<std::int32_t>& b) {
+  std::int64_t sum = 0;
+  for (std::size_t i = 0; i < a.size(); i++) {
+    sum += static_cast<std::int64_t>(a[i]) * b[i];
+  }
+  return sum;
+}
+
+}  // namespace
+
+TEST(dot_product_tests, check_levels_agree_with_reference) {
+  std::mt19937 gen(7);
+  std::uniform_int_distribution<std::int32_t> dist(-1000000, 1000000);
+  // sizes around the vector widths to cover every tail length
+  for (std::size_t n : {0, 1, 3, 7, 8, 15, 16, 17, 31, 33, 1000}) {
+    std::vector<std::int32_t> a(n);
+    std::vector<std::int32_t> b(n);
+    for (std::size_t i = 0; i < n; i++) {
+      a[i] = dist(gen);
+      b[i] = dist(gen);
+    }
+    for (auto level : {ppc::core::SCALAR, ppc::core::AVX2, ppc::core::AVX512, ppc::core::NEON}) {
+      if (ppc::core::simd_supported(level)) {
+        EXPECT_EQ(ppc::core::dot_product(a.data(), b.data(), n, level), reference_dot(a, b)) << n << " " << level;
+      }
+    }
+  }
+}
+
+TEST(dot_product_tests, check_products_do_not_overflow) {
+  const std::size_t n = 1000;
+  const std::int32_t max = std::numeric_limits<std::int32_t>::max();
+  const std::int32_t min = std::numeric_limits<std::int32_t>::min();
+  std::vector<std::int32_t> a(n, max);
+  std::vector<std::int32_t> b(n);
+  for (std::size_t i = 0; i < n; i++) {
+    b[i] = i % 2 == 0 ? max : min;
+  }
+  for (auto level : {ppc::core::SCALAR, ppc::core::AVX2, ppc::core::AVX512, ppc::core::NEON}) {
+    if (ppc::core::simd_supported(level)) {
+      EXPECT_EQ(ppc::core::dot_product(a.data(), b.data(), n, level), -static_cast<std::int64_t>(max) * (n / 2));
+    }
+  }
+}
+
+TEST(dot_product_tests, check_floating_point_plain) {
+  std::vector<double> a(101);
+  std::vector<double> b(101);
+  for (std::size_t i = 0; i < a.size(); i++) {
+    a[i] = static_cast<double>(i);
+    b[i] = 0.5;
+  }
+  EXPECT_DOUBLE_EQ(ppc::core::dot_product(a.data(), b.data(), a.size()), 2525.0);
+
+  std::vector<float> x(10, 2.0F);
+  std::vector<float> y(10, 3.0F);
+  EXPECT_FLOAT_EQ(ppc::core::dot_product(x.data(), y.data(), x.size()), 60.0F);
+}
+
+TEST(dot_product_tests, check_compensated_summation_cancels) {
+  // 1e16 + 1 - 1e16 repeated: plain summation loses every 1
+  std::vector<double> a;
+  std::vector<double> b;
+  for (int i = 0; i < 64; i++) {
+    a.insert(a.end(), {1e16, 1.0, -1e16});
+    b.insert(b.end(), {1.0, 1.0, 1.0});
+  }
+  EXPECT_DOUBLE_EQ(ppc::core::dot_product(a.data(), b.data(), a.size(), ppc::core::COMPENSATED), 64.0);
+  EXPECT_NE(ppc::core::dot_product(a.data(), b.data(), a.size(), ppc::core::PLAIN), 64.0);
+
+  // blocks that split the triples still add up exactly
+  auto head = ppc::core::compensated_dot_product(a.data(), b.data(), 100);
+  auto tail = ppc::core::compensated_dot_product(a.data() + 100, b.data() + 100, a.size() - 100);
+  EXPECT_DOUBLE_EQ((head + tail).value(), 64.0);
+
+  // rounding errors of the products are kept as well: (1 + 2^-12)^2 rounds
+  // to 1 + 2^-11 in float
+  std::vector<float> x(16, 1.0F + 0x1p-12F);
+  std::vector<float> y(16, 1.0F + 0x1p-12F);
+  x.push_back(-16.0F * (1.0F + 0x1p-11F));
+  y.push_back(1.0F);
+  EXPECT_FLOAT_EQ(ppc::core::dot_product(x.data(), y.data(), x.size(), ppc::core::COMPENSATED), 16.0F * 0x1p-24F);
+  EXPECT_EQ(ppc::core::dot_product(x.data(), y.data(), x.size(), ppc::core::PLAIN), 0.0F);
+}
+
+TEST(dot_product_tests, check_batched_rows_with_padding_and_tiles) {
+  std::mt19937 gen(11);
+  std::uniform_int_distribution<std::int32_t> dist(-100000, 100000);
+  // more columns than one tile and a row count that isn't a multiple of four
+  const std::size_t rows = 7;
+  const std::size_t cols = ppc::core::kBatchTile + 37;
+  const std::size_t ld = cols + 3;
+  std::vector<std::int32_t> matrix(rows * ld);
+  std::vector<std::int32_t> x(cols);
+  for (auto& v : matrix) {
+    v = dist(gen);
+  }
+  for (auto& v : x) {
+    v = dist(gen);
+  }
+  std::vector<std::int64_t> expected(rows);
+  for (std::size_t r = 0; r < rows; r++) {
+    auto row = matrix.begin() + static_cast<std::ptrdiff_t>(r * ld);
+    expected[r] = reference_dot(std::vector<std::int32_t>(row, row + cols), x);
+  }
+  for (auto level : {ppc::core::SCALAR, ppc::core::AVX2, ppc::core::AVX512, ppc::core::NEON}) {
+    if (ppc::core::simd_supported(level)) {
+      std::vector<std::int64_t> out(rows, -1);
+      ppc::core::batched_dot_product(matrix.data(), rows, cols, ld, x.data(), out.data(), level);
+      EXPECT_EQ(out, expected) << level;
+    }
+  }
+}
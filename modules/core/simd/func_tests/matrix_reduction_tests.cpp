@@ -0,0 +1,142 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
+
+namespace {
+
+ppc::core::Matrix<int> random_matrix(std::size_t rows, std::size_t cols, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(-1000, 1000);
+  ppc::core::Matrix<int> matrix(rows, cols);
+  for (std::size_t i = 0; i < rows; i++) {
+    for (int& v : matrix.row(i)) {
+      v = dist(gen);
+    }
+  }
+  return matrix;
+}
+
+}  // namespace
+
+TEST(matrix_reduction_tests, check_rows_against_std) {
+  // row lengths around the lane count cover every tail
+  for (std::size_t cols : {1, 31, 32, 33, 100}) {
+    auto matrix = random_matrix(5, cols, cols);
+    std::vector<int> mins;
+    std::vector<int> maxs;
+    std::vector<std::int64_t> sums;
+    ppc::core::reduce_matrix<ppc::core::MIN>(matrix, ppc::core::BY_ROW, mins);
+    ppc::core::reduce_matrix<ppc::core::MAX>(matrix, ppc::core::BY_ROW, maxs);
+    ppc::core::reduce_matrix<ppc::core::SUM>(matrix, ppc::core::BY_ROW, sums);
+    ASSERT_EQ(mins.size(), matrix.rows());
+    for (std::size_t i = 0; i < matrix.rows(); i++) {
+      auto row = matrix.row(i);
+      EXPECT_EQ(mins[i], *std::min_element(row.begin(), row.end()));
+      EXPECT_EQ(maxs[i], *std::max_element(row.begin(), row.end()));
+      std::int64_t sum = 0;
+      for (int v : row) {
+        sum += v;
+      }
+      EXPECT_EQ(sums[i], sum);
+    }
+  }
+}
+
+TEST(matrix_reduction_tests, check_columns_over_several_strips) {
+  const std::size_t cols = (ppc::core::kColumnStripBytes / sizeof(int)) + 5;
+  auto matrix = random_matrix(3, cols, 1);
+  std::vector<int> maxs;
+  ppc::core::reduce_matrix<ppc::core::MAX>(matrix, ppc::core::BY_COLUMN, maxs);
+  ASSERT_EQ(maxs.size(), cols);
+  for (std::size_t j = 0; j < cols; j++) {
+    EXPECT_EQ(maxs[j], std::max({matrix(0, j), matrix(1, j), matrix(2, j)}));
+  }
+}
+
+TEST(matrix_reduction_tests, check_total_of_padded_and_dense_matrices) {
+  auto matrix = random_matrix(7, 9, 2);
+  std::int64_t expected = 0;
+  int expected_min = std::numeric_limits<int>::max();
+  for (std::size_t i = 0; i < matrix.rows(); i++) {
+    for (int v : matrix.row(i)) {
+      expected += v;
+      expected_min = std::min(expected_min, v);
+    }
+  }
+  std::vector<std::int64_t> total;
+  ppc::core::reduce_matrix<ppc::core::SUM>(matrix, ppc::core::TOTAL, total);
+  EXPECT_EQ(total, std::vector<std::int64_t>{expected});
+
+  std::vector<int> dense(matrix.rows() * matrix.cols());
+  for (std::size_t i = 0; i < matrix.rows(); i++) {
+    std::copy(matrix.row(i).begin(), matrix.row(i).end(), dense.begin() + static_cast<std::ptrdiff_t>(i * 9));
+  }
+  auto view = ppc::core::Matrix<const int>::view(dense.data(), matrix.rows(), matrix.cols(), matrix.cols());
+  std::vector<int> min;
+  ppc::core::reduce_matrix<ppc::core::MIN>(view, ppc::core::TOTAL, min);
+  EXPECT_EQ(min, std::vector<int>{expected_min});
+}
+
+TEST(matrix_reduction_tests, check_empty_and_floating_point) {
+  ppc::core::Matrix<double> empty(0, 4);
+  std::vector<double> mins;
+  ppc::core::reduce_matrix<ppc::core::MIN>(empty, ppc::core::BY_COLUMN, mins);
+  EXPECT_EQ(mins, std::vector<double>(4, std::numeric_limits<double>::infinity()));
+
+  ppc::core::Matrix<double> matrix(2, 2);
+  matrix(0, 0) = -0.5;
+  matrix(1, 1) = 2.25;
+  std::vector<double> total;
+  ppc::core::reduce_matrix<ppc::core::SUM>(matrix, ppc::core::TOTAL, total);
+  EXPECT_EQ(total, std::vector<double>{1.75});
+}
+
+TEST(matrix_reduction_tests, check_arg_reduce_finds_first_position) {
+  // sizes around the lane count put the extremum in every lane and the tail
+  for (std::size_t n : {1, 31, 32, 33, 100}) {
+    for (std::size_t at = 0; at < n; at += 7) {
+      // the last element is an equal value found later
+      std::vector<int> values(n, 5);
+      values[at] = values[n - 1] = -3;
+      auto min = ppc::core::arg_reduce_elements<ppc::core::MIN>(values.data(), n, 10);
+      EXPECT_EQ(min.value, -3);
+      EXPECT_EQ(min.index, at + 10) << n;
+
+      values.assign(n, -3);
+      values[at] = values[n - 1] = 5;
+      auto max = ppc::core::arg_reduce_elements<ppc::core::MAX>(values.data(), n);
+      EXPECT_EQ(max.value, 5);
+      EXPECT_EQ(max.index, at) << n;
+    }
+  }
+  auto none = ppc::core::arg_reduce_elements<ppc::core::MIN>(static_cast<const double*>(nullptr), 0);
+  EXPECT_EQ(none.index, ppc::core::kNoIndex);
+}
+
+TEST(matrix_reduction_tests, check_arg_reduce_matrix_skips_padding) {
+  auto matrix = random_matrix(6, 9, 3);
+  matrix(4, 2) = 5000;
+  auto max = ppc::core::arg_reduce_matrix<ppc::core::MAX>(matrix);
+  EXPECT_EQ(max.value, 5000);
+  EXPECT_EQ(max.index, (4 * 9) + 2);
+
+  // rows 1..5 as a block whose positions start after row 0
+  std::uint64_t expected = 9;
+  for (std::uint64_t k = 9; k < 6 * 9; k++) {
+    if (matrix(k / 9, k % 9) < matrix(expected / 9, expected % 9)) {
+      expected = k;
+    }
+  }
+  auto min = ppc::core::arg_reduce_matrix<ppc::core::MIN>(matrix.tile(1, 0, 5, 9), 9);
+  EXPECT_EQ(min.index, expected);
+  EXPECT_EQ(min.value, matrix(expected / 9, expected % 9));
+}
@@ -0,0 +1,111 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+
+#include "core/simd/include/text_scan.hpp"
+
+namespace {
+
+ppc::core::TextCounts reference_scan(const std::string& text) {
+  ppc::core::TextCounts counts;
+  counts.bytes = text.size();
+  for (std::size_t i = 0; i < text.size(); i++) {
+    auto c = static_cast<unsigned char>(text[i]);
+    bool space = std::isspace(c) != 0;
+    bool terminator = c == '.' || c == '!' || c == '?';
+    bool previous_space = i == 0 || std::isspace(static_cast<unsigned char>(text[i - 1])) != 0;
+    bool previous_terminator = i > 0 && (text[i - 1] == '.' || text[i - 1] == '!' || text[i - 1] == '?');
+    counts.letters += std::isalpha(c) != 0 ? 1 : 0;
+    counts.spaces += space ? 1 : 0;
+    counts.terminators += terminator ? 1 : 0;
+    counts.words += !space && previous_space ? 1 : 0;
+    counts.sentences += terminator && !previous_terminator ? 1 : 0;
+  }
+  return counts;
+}
+
+void expect_counts(const ppc::core::TextCounts& actual, const ppc::core::TextCounts& expected) {
+  EXPECT_EQ(actual.bytes, expected.bytes);
+  EXPECT_EQ(actual.letters, expected.letters);
+  EXPECT_EQ(actual.spaces, expected.spaces);
+  EXPECT_EQ(actual.terminators, expected.terminators);
+  EXPECT_EQ(actual.words, expected.words);
+  EXPECT_EQ(actual.sentences, expected.sentences);
+}
+
+// every byte value, with runs of spaces and terminators made likely
+std::string random_text(std::size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> byte(0, 255);
+  std::uniform_int_distribution<int> kind(0, 3);
+  const std::string common = " .!?\t\nab";
+  std::string text(n, ' ');
+  for (char& c : text) {
+    c = kind(gen) == 0 ? static_cast<char>(byte(gen)) : common[byte(gen) % common.size()];
+  }
+  return text;
+}
+
+}  // namespace
+
+TEST(text_scan_tests, check_classes_match_ctype) {
+  for (int b = 0; b < 256; b++) {
+    std::uint8_t expected = (std::isalpha(b) != 0 ? ppc::core::LETTER : 0) |
+                            (std::isspace(b) != 0 ? ppc::core::SPACE : 0) |
+                            (b == '.' || b == '!' || b == '?' ? ppc::core::TERMINATOR : 0);
+    EXPECT_EQ(ppc::core::char_class(static_cast<char>(b)), expected) << b;
+    // every byte alone goes through the vector kernels too
+    std::string text(128, static_cast<char>(b));
+    for (auto level : {ppc::core::SCALAR, ppc::core::AVX2, ppc::core::AVX512, ppc::core::NEON}) {
+      if (ppc::core::simd_supported(level)) {
+        expect_counts(ppc::core::scan_text(text.data(), text.size(), level), reference_scan(text));
+      }
+    }
+  }
+}
+
+TEST(text_scan_tests, check_levels_agree_with_reference) {
+  // sizes around the block of 64 bytes to cover every tail length
+  for (std::size_t n : {0, 1, 63, 64, 65, 127, 128, 1000}) {
+    std::string text = random_text(n, static_cast<unsigned>(n));
+    for (auto level : {ppc::core::SCALAR, ppc::core::AVX2, ppc::core::AVX512, ppc::core::NEON}) {
+      if (ppc::core::simd_supported(level)) {
+        expect_counts(ppc::core::scan_text(text.data(), n, level), reference_scan(text));
+        std::uint64_t dots = 0;
+        for (char c : text) {
+          dots += c == '.' ? 1 : 0;
+        }
+        EXPECT_EQ(ppc::core::count_byte(text.data(), n, '.', level), dots) << n << " " << level;
+      }
+    }
+  }
+}
+
+TEST(text_scan_tests, check_counts_of_blocks_add_up) {
+  std::string text = random_text(300, 5);
+  auto whole = reference_scan(text);
+  // splits inside words, spaces and runs of terminators
+  for (std::size_t split = 0; split <= text.size(); split += 7) {
+    auto head = ppc::core::scan_text(text.data(), split);
+    auto tail = ppc::core::scan_text(text.data() + split, text.size() - split);
+    expect_counts(head + tail, whole);
+  }
+  auto words = ppc::core::scan_text("Well... done!", 13);
+  EXPECT_EQ(words.words, 2u);
+  EXPECT_EQ(words.sentences, 2u);
+}
+
+TEST(text_scan_tests, check_count_byte_beyond_counter_range) {
+  // more than 255 matches per byte counter
+  std::string text(100000, 'x');
+  for (auto level : {ppc::core::SCALAR, ppc::core::AVX2, ppc::core::AVX512, ppc::core::NEON}) {
+    if (ppc::core::simd_supported(level)) {
+      EXPECT_EQ(ppc::core::count_byte(text.data(), text.size() - 3, 'x', level), text.size() - 3);
+    }
+  }
+}
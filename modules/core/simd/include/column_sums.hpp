@@ -0,0 +1,21 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_COLUMN_SUMS_HPP_
+#define MODULES_CORE_INCLUDE_COLUMN_SUMS_HPP_
+
+#include <cstddef>
+
+#include "core/simd/include/matrix_reduction.hpp"
+
+namespace ppc::core {
+
+// Adds the column sums of the row-major rows x cols `matrix` (rows `ld`
+// elements apart) to out[0..cols), see combine_columns.
+template <class T>
+void add_column_sums(const T* matrix, std::size_t rows, std::size_t cols, std::size_t ld, T* out) {
+  combine_columns<SUM, T>(matrix, rows, cols, ld, out);
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_COLUMN_SUMS_HPP_
@@ -0,0 +1,125 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_DOT_PRODUCT_HPP_
+#define MODULES_CORE_INCLUDE_DOT_PRODUCT_HPP_
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#include "core/simd/include/simd_level.hpp"
+
+namespace ppc::core {
+
+// Dot product of int32 vectors: every product is widened to a 64-bit lane
+// before it is added, so the result is exact while it fits into int64. The
+// vector kernels multiply the even and the odd elements of a register
+// separately to get full 64-bit products.
+std::int64_t dot_product(const std::int32_t* a, const std::int32_t* b, std::size_t n, SimdLevel level = simd_level());
+
+// Columns of the shared vector a batched dot product works on at a time:
+// 16 KiB of x stay in L1 while all rows go over them.
+inline constexpr std::size_t kBatchTile = 4096;
+
+// out[r] = dot product of row r of the row-major rows x cols `matrix` (rows
+// `ld` elements apart) with `x`, for all rows. Columns go in tiles of
+// kBatchTile and rows in groups of four that share every load of x.
+void batched_dot_product(const std::int32_t* matrix, std::size_t rows, std::size_t cols, std::size_t ld,
+                         const std::int32_t* x, std::int64_t* out, SimdLevel level = simd_level());
+
+enum Summation { PLAIN, COMPENSATED };
+
+namespace detail {
+
+// s + e == a + b exactly
+template <std::floating_point T>
+void two_sum(T a, T b, T& s, T& e) {
+  s = a + b;
+  T bv = s - a;
+  e = (a - (s - bv)) + (b - bv);
+}
+
+}  // namespace detail
+
+// Unevaluated sum `sum + error` of a compensated dot product. Partial
+// results of blocks are combined with + before they are rounded to T, so
+// a split of the vectors doesn't cost accuracy.
+template <std::floating_point T>
+struct CompensatedSum {
+  T sum{};
+  T error{};
+
+  [[nodiscard]] T value() const { return sum + error; }
+};
+
+template <std::floating_point T>
+CompensatedSum<T> operator+(const CompensatedSum<T>& x, const CompensatedSum<T>& y) {
+  CompensatedSum<T> result;
+  detail::two_sum(x.sum, y.sum, result.sum, result.error);
+  result.error += x.error + y.error;
+  return result;
+}
+
+// Dot product with the rounding errors of the products (through fma) and
+// of the additions kept in a second set of lanes: as accurate as if it were
+// computed in twice the precision of T and then rounded (Ogita, Rump and
+// Oishi's Dot2), at a few times the cost of the plain loop.
+template <std::floating_point T>
+CompensatedSum<T> compensated_dot_product(const T* a, const T* b, std::size_t n) {
+  constexpr std::size_t kLanes = 8;
+  std::array<T, kLanes> sum{};
+  std::array<T, kLanes> error{};
+  auto add = [&](std::size_t l, T x, T y) {
+    T p = x * y;
+    T product_error = std::fma(x, y, -p);
+    T sum_error;
+    detail::two_sum(sum[l], p, sum[l], sum_error);
+    error[l] += product_error + sum_error;
+  };
+  std::size_t vectorized = n - (n % kLanes);
+  for (std::size_t i = 0; i < vectorized; i += kLanes) {
+    for (std::size_t l = 0; l < kLanes; l++) {
+      add(l, a[i + l], b[i + l]);
+    }
+  }
+  for (std::size_t i = vectorized; i < n; i++) {
+    add(i - vectorized, a[i], b[i]);
+  }
+  CompensatedSum<T> result;
+  for (std::size_t l = 0; l < kLanes; l++) {
+    result = result + CompensatedSum<T>{sum[l], error[l]};
+  }
+  return result;
+}
+
+// Dot product of float or double vectors with one accumulator per lane so
+// the loop vectorizes without reassociation flags; COMPENSATED is
+// compensated_dot_product rounded to T.
+template <std::floating_point T>
+T dot_product(const T* a, const T* b, std::size_t n, Summation summation = PLAIN) {
+  if (summation == COMPENSATED) {
+    return compensated_dot_product(a, b, n).value();
+  }
+  constexpr std::size_t kLanes = 8;
+  std::array<T, kLanes> sum{};
+  std::size_t vectorized = n - (n % kLanes);
+  for (std::size_t i = 0; i < vectorized; i += kLanes) {
+    for (std::size_t l = 0; l < kLanes; l++) {
+      sum[l] += a[i + l] * b[i + l];
+    }
+  }
+  for (std::size_t i = vectorized; i < n; i++) {
+    sum[i - vectorized] += a[i] * b[i];
+  }
+  T result{};
+  for (T lane : sum) {
+    result += lane;
+  }
+  return result;
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_DOT_PRODUCT_HPP_
@@ -0,0 +1,217 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_MATRIX_REDUCTION_HPP_
+#define MODULES_CORE_INCLUDE_MATRIX_REDUCTION_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "core/matrix/include/matrix.hpp"
+
+namespace ppc::core {
+
+enum Reduction { SUM, MIN, MAX };
+
+// one result per row, one per column or a single one for the whole matrix
+enum ReductionAxis { BY_ROW, BY_COLUMN, TOTAL };
+
+// Bytes of column accumulators kept at a time, a quarter of a typical L1.
+inline constexpr std::size_t kColumnStripBytes = 8192;
+
+// Independent accumulators of a row reduction: enough for two AVX-512
+// registers of int or float, so the loop vectorizes without reassociation
+// flags and a floating-point sum is done in a fixed order.
+inline constexpr std::size_t kReductionLanes = 32;
+
+template <Reduction Op, class Acc>
+constexpr Acc reduction_identity() {
+  if constexpr (Op == SUM) {
+    return Acc{};
+  } else if constexpr (Op == MIN) {
+    return std::numeric_limits<Acc>::has_infinity ? std::numeric_limits<Acc>::infinity()
+                                                  : std::numeric_limits<Acc>::max();
+  } else {
+    return std::numeric_limits<Acc>::has_infinity ? -std::numeric_limits<Acc>::infinity()
+                                                  : std::numeric_limits<Acc>::lowest();
+  }
+}
+
+template <Reduction Op, class Acc>
+constexpr Acc combine(Acc a, Acc b) {
+  if constexpr (Op == SUM) {
+    return a + b;
+  } else if constexpr (Op == MIN) {
+    return b < a ? b : a;
+  } else {
+    return a < b ? b : a;
+  }
+}
+
+// Op of n contiguous elements, accumulated in Acc (e.g. a wider type for
+// sums of int).
+template <Reduction Op, class Acc, class T>
+Acc reduce_elements(const T* values, std::size_t n) {
+  std::array<Acc, kReductionLanes> lanes;
+  lanes.fill(reduction_identity<Op, Acc>());
+  std::size_t vectorized = n - (n % kReductionLanes);
+  for (std::size_t i = 0; i < vectorized; i += kReductionLanes) {
+    for (std::size_t l = 0; l < kReductionLanes; l++) {
+      lanes[l] = combine<Op, Acc>(lanes[l], static_cast<Acc>(values[i + l]));
+    }
+  }
+  for (std::size_t i = vectorized; i < n; i++) {
+    lanes[i - vectorized] = combine<Op, Acc>(lanes[i - vectorized], static_cast<Acc>(values[i]));
+  }
+  Acc result = reduction_identity<Op, Acc>();
+  for (Acc lane : lanes) {
+    result = combine<Op, Acc>(result, lane);
+  }
+  return result;
+}
+
+// out[i] = Op of row i of the row-major rows x cols `matrix` (rows `ld`
+// elements apart)
+template <Reduction Op, class Acc, class T>
+void reduce_rows(const T* matrix, std::size_t rows, std::size_t cols, std::size_t ld, Acc* out) {
+  for (std::size_t i = 0; i < rows; i++) {
+    out[i] = reduce_elements<Op, Acc>(matrix + (i * ld), cols);
+  }
+}
+
+// Combines Op of every column into out[0..cols). Rows are streamed
+// contiguously into a strip of accumulators that stays in L1, so the inner
+// loop vectorizes and the matrix is read once in memory order; wide
+// matrices are processed strip by strip.
+template <Reduction Op, class Acc, class T>
+void combine_columns(const T* matrix, std::size_t rows, std::size_t cols, std::size_t ld, Acc* out) {
+  constexpr std::size_t kStrip = kColumnStripBytes / sizeof(Acc);
+  std::array<Acc, kStrip> strip;
+  for (std::size_t col = 0; col < cols; col += kStrip) {
+    std::size_t width = std::min(kStrip, cols - col);
+    std::fill_n(strip.begin(), width, reduction_identity<Op, Acc>());
+    for (std::size_t row = 0; row < rows; row++) {
+      const T* values = matrix + (row * ld) + col;
+      for (std::size_t j = 0; j < width; j++) {
+        strip[j] = combine<Op, Acc>(strip[j], static_cast<Acc>(values[j]));
+      }
+    }
+    for (std::size_t j = 0; j < width; j++) {
+      out[col + j] = combine<Op, Acc>(out[col + j], strip[j]);
+    }
+  }
+}
+
+// Op of all elements; rows without padding between them are reduced as
+// one run, so short rows don't cost a horizontal step each.
+template <Reduction Op, class Acc, class T>
+Acc reduce_total(const T* matrix, std::size_t rows, std::size_t cols, std::size_t ld) {
+  if (ld == cols) {
+    return reduce_elements<Op, Acc>(matrix, rows * cols);
+  }
+  Acc result = reduction_identity<Op, Acc>();
+  for (std::size_t i = 0; i < rows; i++) {
+    result = combine<Op, Acc>(result, reduce_elements<Op, Acc>(matrix + (i * ld), cols));
+  }
+  return result;
+}
+
+// Op of `matrix` along `axis` into `out`: rows() results BY_ROW, cols()
+// results BY_COLUMN, one TOTAL. Every backend applies it to its own block
+// of rows (a tile() of the matrix, or the block of an MPI rank) and
+// combines the partial results with combine<Op>: element-wise BY_COLUMN
+// and TOTAL, concatenated BY_ROW.
+template <Reduction Op, class Acc, class T>
+void reduce_matrix(const Matrix<T>& matrix, ReductionAxis axis, std::vector<Acc>& out) {
+  switch (axis) {
+    case BY_ROW:
+      out.resize(matrix.rows());
+      reduce_rows<Op>(matrix.data(), matrix.rows(), matrix.cols(), matrix.ld(), out.data());
+      break;
+    case BY_COLUMN:
+      out.assign(matrix.cols(), reduction_identity<Op, Acc>());
+      combine_columns<Op>(matrix.data(), matrix.rows(), matrix.cols(), matrix.ld(), out.data());
+      break;
+    default:
+      out.assign(1, reduce_total<Op, Acc>(matrix.data(), matrix.rows(), matrix.cols(), matrix.ld()));
+  }
+}
+
+// position of the extremum of no elements
+inline constexpr std::uint64_t kNoIndex = std::numeric_limits<std::uint64_t>::max();
+
+// Value and position of the MIN or MAX of some elements, the first
+// position among equal values.
+template <class T>
+struct Extremum {
+  T value;
+  std::uint64_t index;
+};
+
+// The better of two extrema, the earlier one among equal values, so the
+// result doesn't depend on the order the partial results are combined in.
+template <Reduction Op, class T>
+constexpr Extremum<T> combine_extrema(const Extremum<T>& a, const Extremum<T>& b) {
+  bool better = Op == MIN ? b.value < a.value : a.value < b.value;
+  return better || (!(a.value < b.value) && !(b.value < a.value) && b.index < a.index) ? b : a;
+}
+
+// MIN or MAX of n contiguous elements with its position plus `offset`, in
+// the same pass. Every lane keeps its best value and where it was found,
+// both updated with a compare and a select, so the loop vectorizes like
+// reduce_elements and the data isn't scanned again for the position.
+template <Reduction Op, class T>
+Extremum<T> arg_reduce_elements(const T* values, std::size_t n, std::uint64_t offset = 0) {
+  if (n == 0) {
+    return {reduction_identity<Op, T>(), kNoIndex};
+  }
+  // lanes start at the first element, so every position found is a real one
+  std::array<T, kReductionLanes> best;
+  std::array<std::uint64_t, kReductionLanes> where;
+  best.fill(values[0]);
+  where.fill(0);
+  std::size_t vectorized = n - (n % kReductionLanes);
+  for (std::size_t i = 0; i < vectorized; i += kReductionLanes) {
+    for (std::size_t l = 0; l < kReductionLanes; l++) {
+      T value = values[i + l];
+      bool better = Op == MIN ? value < best[l] : best[l] < value;
+      best[l] = better ? value : best[l];
+      where[l] = better ? i + l : where[l];
+    }
+  }
+  for (std::size_t i = vectorized; i < n; i++) {
+    std::size_t l = i - vectorized;
+    bool better = Op == MIN ? values[i] < best[l] : best[l] < values[i];
+    best[l] = better ? values[i] : best[l];
+    where[l] = better ? i : where[l];
+  }
+  Extremum<T> result{best[0], where[0]};
+  for (std::size_t l = 1; l < kReductionLanes; l++) {
+    result = combine_extrema<Op>(result, Extremum<T>{best[l], where[l]});
+  }
+  result.index += offset;
+  return result;
+}
+
+// MIN or MAX of `matrix` with its row-major position i * cols() + j plus
+// `offset`, the padding between rows is not counted.
+template <Reduction Op, class T>
+Extremum<std::remove_const_t<T>> arg_reduce_matrix(const Matrix<T>& matrix, std::uint64_t offset = 0) {
+  if (matrix.ld() == matrix.cols()) {
+    return arg_reduce_elements<Op>(matrix.data(), matrix.rows() * matrix.cols(), offset);
+  }
+  Extremum<std::remove_const_t<T>> result{reduction_identity<Op, std::remove_const_t<T>>(), kNoIndex};
+  for (std::size_t i = 0; i < matrix.rows(); i++) {
+    result = combine_extrema<Op>(result, arg_reduce_elements<Op>(matrix.row(i).data(), matrix.cols(),
+                                                                 offset + (i * matrix.cols())));
+  }
+  return result;
+}
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_MATRIX_REDUCTION_HPP_
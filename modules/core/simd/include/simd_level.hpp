@@ -0,0 +1,19 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_SIMD_LEVEL_HPP_
+#define MODULES_CORE_INCLUDE_SIMD_LEVEL_HPP_
+
+namespace ppc::core {
+
+// Instruction sets the vector kernels are built for. AVX2 and AVX512 are
+// compiled for x86-64 with GCC and Clang regardless of -march and picked at
+// run time, NEON is used when the target has it.
+enum SimdLevel { SCALAR, AVX2, AVX512, NEON };
+
+// best level supported by the current CPU
+SimdLevel simd_level();
+bool simd_supported(SimdLevel level);
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_SIMD_LEVEL_HPP_
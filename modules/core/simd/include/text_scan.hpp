@@ -0,0 +1,63 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_CORE_INCLUDE_TEXT_SCAN_HPP_
+#define MODULES_CORE_INCLUDE_TEXT_SCAN_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+#include "core/simd/include/simd_level.hpp"
+
+namespace ppc::core {
+
+// Classes of a byte of text, as bits: the ASCII predicates of the "C"
+// locale, so bytes from 0x80 are in none of them.
+enum CharClass : std::uint8_t {
+  LETTER = 1,      // A-Z, a-z (isalpha)
+  SPACE = 2,       // ' ', '\t', '\n', '\v', '\f', '\r' (isspace)
+  TERMINATOR = 4,  // '.', '!', '?'
+};
+
+constexpr std::uint8_t char_class(char c) {
+  auto b = static_cast<unsigned char>(c);
+  if ((b >= 'A' && b <= 'Z') || (b >= 'a' && b <= 'z')) {
+    return LETTER;
+  }
+  if (b == ' ' || (b >= '\t' && b <= '\r')) {
+    return SPACE;
+  }
+  return b == '.' || b == '!' || b == '?' ? TERMINATOR : 0;
+}
+
+// Counts of one pass over a text. A word is a run of bytes other than
+// spaces and a sentence ends with a run of terminators ("Well..." is one).
+// Counts of consecutive blocks of a text are combined with +, which joins
+// the words and sentences cut at the border, so a text can be scanned in
+// any split.
+struct TextCounts {
+  std::uint64_t bytes = 0;
+  std::uint64_t letters = 0;
+  std::uint64_t spaces = 0;
+  std::uint64_t terminators = 0;
+  std::uint64_t words = 0;
+  std::uint64_t sentences = 0;
+  // classes of the first and the last byte
+  std::uint8_t first = 0;
+  std::uint8_t last = 0;
+};
+
+// counts of a block followed by the block `next`
+TextCounts operator+(const TextCounts& block, const TextCounts& next);
+
+// Counts of n bytes of text in one pass. The vector kernels classify 64
+// bytes at a time with two nibble table lookups (pshufb / tbl) into bit
+// masks, one bit per byte and class; words and sentences are the runs the
+// masks start, found with a shift, and everything is counted by popcount.
+TextCounts scan_text(const char* text, std::size_t n, SimdLevel level = simd_level());
+
+// number of the n bytes of text equal to `byte`
+std::uint64_t count_byte(const char* text, std::size_t n, char byte, SimdLevel level = simd_level());
+
+}  // namespace ppc::core
+
+#endif  // MODULES_CORE_INCLUDE_TEXT_SCAN_HPP_
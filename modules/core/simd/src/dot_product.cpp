@@ -0,0 +1,200 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/simd/include/dot_product.hpp"
+
+#include <algorithm>
+#include <array>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PPC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define PPC_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+std::int64_t dot_scalar(const std::int32_t* a, const std::int32_t* b, std::size_t n) {
+  std::array<std::int64_t, 4> sum{};
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    for (std::size_t l = 0; l < 4; l++) {
+      sum[l] += static_cast<std::int64_t>(a[i + l]) * b[i + l];
+    }
+  }
+  for (; i < n; i++) {
+    sum[0] += static_cast<std::int64_t>(a[i]) * b[i];
+  }
+  return sum[0] + sum[1] + sum[2] + sum[3];
+}
+
+// adds the dot products of rows r..r+3 (`ld` apart) with x to out[0..3]
+void rows4_scalar(const std::int32_t* m, std::size_t ld, const std::int32_t* x, std::size_t n, std::int64_t* out) {
+  for (std::size_t r = 0; r < 4; r++) {
+    out[r] += dot_scalar(m + (r * ld), x, n);
+  }
+}
+
+#ifdef PPC_SIMD_X86
+
+// _mm*_mul_epi32 multiplies the low (even) int32 of every 64-bit lane into
+// a full int64, the odd elements are moved down by a 64-bit shift first
+__attribute__((target("avx2"))) std::int64_t dot_avx2(const std::int32_t* a, const std::int32_t* b, std::size_t n) {
+  __m256i even = _mm256_setzero_si256();
+  __m256i odd = _mm256_setzero_si256();
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+    __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+    even = _mm256_add_epi64(even, _mm256_mul_epi32(x, y));
+    odd = _mm256_add_epi64(odd, _mm256_mul_epi32(_mm256_srli_epi64(x, 32), _mm256_srli_epi64(y, 32)));
+  }
+  alignas(32) std::array<std::int64_t, 4> lanes;
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()), _mm256_add_epi64(even, odd));
+  return lanes[0] + lanes[1] + lanes[2] + lanes[3] + dot_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx2"))) void rows4_avx2(const std::int32_t* m, std::size_t ld, const std::int32_t* x,
+                                                std::size_t n, std::int64_t* out) {
+  __m256i sum[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+    __m256i y_odd = _mm256_srli_epi64(y, 32);
+    for (std::size_t r = 0; r < 4; r++) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(m + (r * ld) + i));
+      sum[r] = _mm256_add_epi64(sum[r], _mm256_mul_epi32(v, y));
+      sum[r] = _mm256_add_epi64(sum[r], _mm256_mul_epi32(_mm256_srli_epi64(v, 32), y_odd));
+    }
+  }
+  for (std::size_t r = 0; r < 4; r++) {
+    alignas(32) std::array<std::int64_t, 4> lanes;
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()), sum[r]);
+    out[r] += lanes[0] + lanes[1] + lanes[2] + lanes[3] + dot_scalar(m + (r * ld) + i, x + i, n - i);
+  }
+}
+
+// GCC's AVX-512 intrinsics start from deliberately undefined registers
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+__attribute__((target("avx512f"))) std::int64_t dot_avx512(const std::int32_t* a, const std::int32_t* b,
+                                                           std::size_t n) {
+  __m512i even = _mm512_setzero_si512();
+  __m512i odd = _mm512_setzero_si512();
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512i x = _mm512_loadu_si512(a + i);
+    __m512i y = _mm512_loadu_si512(b + i);
+    even = _mm512_add_epi64(even, _mm512_mul_epi32(x, y));
+    odd = _mm512_add_epi64(odd, _mm512_mul_epi32(_mm512_srli_epi64(x, 32), _mm512_srli_epi64(y, 32)));
+  }
+  return _mm512_reduce_add_epi64(_mm512_add_epi64(even, odd)) + dot_scalar(a + i, b + i, n - i);
+}
+
+__attribute__((target("avx512f"))) void rows4_avx512(const std::int32_t* m, std::size_t ld, const std::int32_t* x,
+                                                     std::size_t n, std::int64_t* out) {
+  __m512i sum[4] = {_mm512_setzero_si512(), _mm512_setzero_si512(), _mm512_setzero_si512(), _mm512_setzero_si512()};
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512i y = _mm512_loadu_si512(x + i);
+    __m512i y_odd = _mm512_srli_epi64(y, 32);
+    for (std::size_t r = 0; r < 4; r++) {
+      __m512i v = _mm512_loadu_si512(m + (r * ld) + i);
+      sum[r] = _mm512_add_epi64(sum[r], _mm512_mul_epi32(v, y));
+      sum[r] = _mm512_add_epi64(sum[r], _mm512_mul_epi32(_mm512_srli_epi64(v, 32), y_odd));
+    }
+  }
+  for (std::size_t r = 0; r < 4; r++) {
+    out[r] += _mm512_reduce_add_epi64(sum[r]) + dot_scalar(m + (r * ld) + i, x + i, n - i);
+  }
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif
+
+#ifdef PPC_SIMD_NEON
+
+std::int64_t dot_neon(const std::int32_t* a, const std::int32_t* b, std::size_t n) {
+  int64x2_t low = vdupq_n_s64(0);
+  int64x2_t high = vdupq_n_s64(0);
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    int32x4_t x = vld1q_s32(a + i);
+    int32x4_t y = vld1q_s32(b + i);
+    low = vmlal_s32(low, vget_low_s32(x), vget_low_s32(y));
+    high = vmlal_high_s32(high, x, y);
+  }
+  return vaddvq_s64(vaddq_s64(low, high)) + dot_scalar(a + i, b + i, n - i);
+}
+
+void rows4_neon(const std::int32_t* m, std::size_t ld, const std::int32_t* x, std::size_t n, std::int64_t* out) {
+  int64x2_t sum[4] = {vdupq_n_s64(0), vdupq_n_s64(0), vdupq_n_s64(0), vdupq_n_s64(0)};
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    int32x4_t y = vld1q_s32(x + i);
+    for (std::size_t r = 0; r < 4; r++) {
+      int32x4_t v = vld1q_s32(m + (r * ld) + i);
+      sum[r] = vmlal_s32(sum[r], vget_low_s32(v), vget_low_s32(y));
+      sum[r] = vmlal_high_s32(sum[r], v, y);
+    }
+  }
+  for (std::size_t r = 0; r < 4; r++) {
+    out[r] += vaddvq_s64(sum[r]) + dot_scalar(m + (r * ld) + i, x + i, n - i);
+  }
+}
+
+#endif
+
+}  // namespace
+
+std::int64_t ppc::core::dot_product(const std::int32_t* a, const std::int32_t* b, std::size_t n, SimdLevel level) {
+  switch (level) {
+#ifdef PPC_SIMD_X86
+    case AVX2:
+      return dot_avx2(a, b, n);
+    case AVX512:
+      return dot_avx512(a, b, n);
+#endif
+#ifdef PPC_SIMD_NEON
+    case NEON:
+      return dot_neon(a, b, n);
+#endif
+    default:
+      return dot_scalar(a, b, n);
+  }
+}
+
+void ppc::core::batched_dot_product(const std::int32_t* matrix, std::size_t rows, std::size_t cols, std::size_t ld,
+                                    const std::int32_t* x, std::int64_t* out, SimdLevel level) {
+  auto rows4 = rows4_scalar;
+#ifdef PPC_SIMD_X86
+  if (level == AVX2) {
+    rows4 = rows4_avx2;
+  } else if (level == AVX512) {
+    rows4 = rows4_avx512;
+  }
+#endif
+#ifdef PPC_SIMD_NEON
+  if (level == NEON) {
+    rows4 = rows4_neon;
+  }
+#endif
+  std::fill(out, out + rows, 0);
+  for (std::size_t col = 0; col < cols; col += kBatchTile) {
+    std::size_t n = std::min(kBatchTile, cols - col);
+    std::size_t r = 0;
+    for (; r + 4 <= rows; r += 4) {
+      rows4(matrix + (r * ld) + col, ld, x + col, n, out + r);
+    }
+    for (; r < rows; r++) {
+      out[r] += dot_product(matrix + (r * ld) + col, x + col, n, level);
+    }
+  }
+}
@@ -0,0 +1,35 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/simd/include/simd_level.hpp"
+
+#include <initializer_list>
+
+bool ppc::core::simd_supported(SimdLevel level) {
+  switch (level) {
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    case AVX2:
+      return __builtin_cpu_supports("avx2") != 0;
+    case AVX512:
+      return __builtin_cpu_supports("avx512f") != 0;
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+    case NEON:
+      return true;
+#endif
+    case SCALAR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+ppc::core::SimdLevel ppc::core::simd_level() {
+  static const SimdLevel level = [] {
+    for (SimdLevel candidate : {AVX512, AVX2, NEON}) {
+      if (simd_supported(candidate)) {
+        return candidate;
+      }
+    }
+    return SCALAR;
+  }();
+  return level;
+}
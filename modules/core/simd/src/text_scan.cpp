@@ -0,0 +1,362 @@
+// Copyright 2024 Nesterov Alexander
+#include "core/simd/include/text_scan.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define PPC_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define PPC_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+// the block counting is inlined into the vector kernels to get their popcount
+#if defined(__GNUC__) || defined(__clang__)
+#define PPC_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+#define PPC_ALWAYS_INLINE inline
+#endif
+
+namespace {
+
+using ppc::core::TextCounts;
+
+constexpr std::size_t kBlock = 64;
+
+// one bit per byte of a block of 64 bytes for each class
+struct Masks {
+  std::uint64_t letter = 0;
+  std::uint64_t space = 0;
+  std::uint64_t terminator = 0;
+};
+
+// Adds the counts of a block of 64 bytes. A word or a sentence is counted
+// at its first byte, `word` and `sentence` carry whether the byte before the
+// block continues one.
+PPC_ALWAYS_INLINE void count_masks(const Masks& m, TextCounts& counts, std::uint64_t& word, std::uint64_t& sentence) {
+  std::uint64_t in_word = ~m.space;
+  counts.letters += std::popcount(m.letter);
+  counts.spaces += std::popcount(m.space);
+  counts.terminators += std::popcount(m.terminator);
+  counts.words += std::popcount(in_word & ~((in_word << 1) | word));
+  counts.sentences += std::popcount(m.terminator & ~((m.terminator << 1) | sentence));
+  word = in_word >> (kBlock - 1);
+  sentence = m.terminator >> (kBlock - 1);
+}
+
+// adds the class and run counts of `local` to `counts`
+void add_counts(TextCounts& counts, const TextCounts& local) {
+  counts.letters += local.letters;
+  counts.spaces += local.spaces;
+  counts.terminators += local.terminators;
+  counts.words += local.words;
+  counts.sentences += local.sentences;
+}
+
+// char_class of every byte
+constexpr auto kClasses = [] {
+  std::array<std::uint8_t, 256> classes{};
+  for (std::size_t b = 0; b < classes.size(); b++) {
+    classes[b] = ppc::core::char_class(static_cast<char>(b));
+  }
+  return classes;
+}();
+
+// Counts of n bytes of text one at a time, for the scalar level and the
+// tails of the vector kernels.
+void scan_scalar(const char* text, std::size_t n, TextCounts& counts, std::uint64_t& word, std::uint64_t& sentence) {
+  TextCounts local;
+  std::uint64_t previous_word = word;
+  std::uint64_t previous_terminator = sentence;
+  for (std::size_t i = 0; i < n; i++) {
+    std::uint64_t c = kClasses[static_cast<unsigned char>(text[i])];
+    std::uint64_t in_word = ((c >> 1) & 1) ^ 1;
+    std::uint64_t terminator = (c >> 2) & 1;
+    local.letters += c & 1;
+    local.spaces += in_word ^ 1;
+    local.terminators += terminator;
+    local.words += in_word & (previous_word ^ 1);
+    local.sentences += terminator & (previous_terminator ^ 1);
+    previous_word = in_word;
+    previous_terminator = terminator;
+  }
+  add_counts(counts, local);
+  word = previous_word;
+  sentence = previous_terminator;
+}
+
+std::uint64_t count_byte_scalar(const char* text, std::size_t n, char byte) {
+  std::uint64_t count = 0;
+  for (std::size_t i = 0; i < n; i++) {
+    count += text[i] == byte ? 1 : 0;
+  }
+  return count;
+}
+
+// Class bits of a byte are looked up by its low and by its high nibble and
+// ANDed, so every bit stands for a set of bytes with some low and some high
+// nibbles: letters are 0x41-0x4F, 0x61-0x6F (bit 0) and 0x50-0x5A,
+// 0x70-0x7A (bit 1), spaces 0x20 (bit 2) and 0x09-0x0D (bit 3), terminators
+// '!' and '.' (bit 4) and '?' (bit 5). Bytes from 0x80 have no high nibble
+// bits.
+constexpr std::uint8_t kLetterBits = 0x03;
+constexpr std::uint8_t kSpaceBits = 0x0C;
+constexpr std::uint8_t kTerminatorBits = 0x30;
+constexpr std::array<std::uint8_t, 16> kLowNibble = {0x06, 0x13, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+                                                     0x03, 0x0B, 0x0B, 0x09, 0x09, 0x09, 0x11, 0x21};
+constexpr std::array<std::uint8_t, 16> kHighNibble = {0x08, 0x00, 0x14, 0x20, 0x01, 0x02, 0x01, 0x02,
+                                                      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+#ifdef PPC_SIMD_X86
+
+__attribute__((target("avx2"))) inline __m256i nibble_table(const std::array<std::uint8_t, 16>& table) {
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(table.data())));
+}
+
+// bit j set if byte j of `classes` has any of `bits`
+__attribute__((target("avx2"))) inline std::uint32_t any_bits(__m256i classes, std::uint8_t bits) {
+  __m256i none = _mm256_cmpeq_epi8(_mm256_and_si256(classes, _mm256_set1_epi8(static_cast<char>(bits))),
+                                   _mm256_setzero_si256());
+  return ~static_cast<std::uint32_t>(_mm256_movemask_epi8(none));
+}
+
+__attribute__((target("avx2"))) inline Masks classify_avx2(const char* text, __m256i low_table, __m256i high_table) {
+  const __m256i nibble = _mm256_set1_epi8(0x0F);
+  Masks m;
+  for (std::size_t half = 0; half < 2; half++) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + (half * 32)));
+    __m256i low = _mm256_shuffle_epi8(low_table, _mm256_and_si256(v, nibble));
+    __m256i high = _mm256_shuffle_epi8(high_table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+    __m256i classes = _mm256_and_si256(low, high);
+    m.letter |= static_cast<std::uint64_t>(any_bits(classes, kLetterBits)) << (half * 32);
+    m.space |= static_cast<std::uint64_t>(any_bits(classes, kSpaceBits)) << (half * 32);
+    m.terminator |= static_cast<std::uint64_t>(any_bits(classes, kTerminatorBits)) << (half * 32);
+  }
+  return m;
+}
+
+// Counts of the whole blocks of text, returns the bytes scanned. The counts
+// are kept in locals: the text is char, which may alias them.
+__attribute__((target("avx2,popcnt"))) std::size_t scan_avx2(const char* text, std::size_t n, TextCounts& counts,
+                                                             std::uint64_t& word, std::uint64_t& sentence) {
+  const __m256i low_table = nibble_table(kLowNibble);
+  const __m256i high_table = nibble_table(kHighNibble);
+  TextCounts local;
+  std::uint64_t local_word = word;
+  std::uint64_t local_sentence = sentence;
+  std::size_t i = 0;
+  for (; i + kBlock <= n; i += kBlock) {
+    count_masks(classify_avx2(text + i, low_table, high_table), local, local_word, local_sentence);
+  }
+  add_counts(counts, local);
+  word = local_word;
+  sentence = local_sentence;
+  return i;
+}
+
+// GCC's AVX-512 intrinsics start from deliberately undefined registers
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+// A 64-byte block is one register and vptestmb gives the masks directly.
+__attribute__((target("avx512f,avx512bw,popcnt"))) std::size_t scan_avx512(const char* text, std::size_t n,
+                                                                          TextCounts& counts, std::uint64_t& word,
+                                                                          std::uint64_t& sentence) {
+  const __m512i low_table =
+      _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(kLowNibble.data())));
+  const __m512i high_table =
+      _mm512_broadcast_i32x4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(kHighNibble.data())));
+  const __m512i nibble = _mm512_set1_epi8(0x0F);
+  const __m512i letter_bits = _mm512_set1_epi8(kLetterBits);
+  const __m512i space_bits = _mm512_set1_epi8(kSpaceBits);
+  const __m512i terminator_bits = _mm512_set1_epi8(kTerminatorBits);
+  TextCounts local;
+  std::uint64_t local_word = word;
+  std::uint64_t local_sentence = sentence;
+  std::size_t i = 0;
+  for (; i + kBlock <= n; i += kBlock) {
+    __m512i v = _mm512_loadu_si512(text + i);
+    __m512i low = _mm512_shuffle_epi8(low_table, _mm512_and_si512(v, nibble));
+    __m512i high = _mm512_shuffle_epi8(high_table, _mm512_and_si512(_mm512_srli_epi16(v, 4), nibble));
+    __m512i classes = _mm512_and_si512(low, high);
+    Masks m{_mm512_test_epi8_mask(classes, letter_bits), _mm512_test_epi8_mask(classes, space_bits),
+            _mm512_test_epi8_mask(classes, terminator_bits)};
+    count_masks(m, local, local_word, local_sentence);
+  }
+  add_counts(counts, local);
+  word = local_word;
+  sentence = local_sentence;
+  return i;
+}
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+bool has_avx512bw() {
+  static const bool supported = __builtin_cpu_supports("avx512bw") != 0;
+  return supported;
+}
+
+// Matches are counted in byte counters (a match is -1, subtracted) that
+// are summed by psadbw before they can overflow.
+__attribute__((target("avx2"))) std::uint64_t count_byte_avx2(const char* text, std::size_t n, char byte) {
+  const __m256i target = _mm256_set1_epi8(byte);
+  std::uint64_t count = 0;
+  std::size_t i = 0;
+  while (n - i >= 32) {
+    std::size_t end = i + (std::min<std::size_t>((n - i) / 32, 255) * 32);
+    __m256i counters = _mm256_setzero_si256();
+    for (; i < end; i += 32) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(text + i));
+      counters = _mm256_sub_epi8(counters, _mm256_cmpeq_epi8(v, target));
+    }
+    alignas(32) std::array<std::uint64_t, 4> lanes;
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes.data()), _mm256_sad_epu8(counters, _mm256_setzero_si256()));
+    count += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+  }
+  return count + count_byte_scalar(text + i, n - i, byte);
+}
+
+#endif
+
+#ifdef PPC_SIMD_NEON
+
+// bit j of the result set if byte j of the 64 bytes of a..d is 0xFF
+inline std::uint64_t movemask_neon(uint8x16_t a, uint8x16_t b, uint8x16_t c, uint8x16_t d) {
+  const uint8x16_t weights = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+  uint8x16_t ab = vpaddq_u8(vandq_u8(a, weights), vandq_u8(b, weights));
+  uint8x16_t cd = vpaddq_u8(vandq_u8(c, weights), vandq_u8(d, weights));
+  uint8x16_t abcd = vpaddq_u8(ab, cd);
+  return vgetq_lane_u64(vreinterpretq_u64_u8(vpaddq_u8(abcd, abcd)), 0);
+}
+
+inline Masks classify_neon(const char* text, uint8x16_t low_table, uint8x16_t high_table) {
+  std::array<uint8x16_t, 4> letter;
+  std::array<uint8x16_t, 4> space;
+  std::array<uint8x16_t, 4> terminator;
+  for (std::size_t q = 0; q < 4; q++) {
+    uint8x16_t v = vld1q_u8(reinterpret_cast<const std::uint8_t*>(text) + (q * 16));
+    uint8x16_t classes =
+        vandq_u8(vqtbl1q_u8(low_table, vandq_u8(v, vdupq_n_u8(0x0F))), vqtbl1q_u8(high_table, vshrq_n_u8(v, 4)));
+    letter[q] = vtstq_u8(classes, vdupq_n_u8(kLetterBits));
+    space[q] = vtstq_u8(classes, vdupq_n_u8(kSpaceBits));
+    terminator[q] = vtstq_u8(classes, vdupq_n_u8(kTerminatorBits));
+  }
+  return {movemask_neon(letter[0], letter[1], letter[2], letter[3]),
+          movemask_neon(space[0], space[1], space[2], space[3]),
+          movemask_neon(terminator[0], terminator[1], terminator[2], terminator[3])};
+}
+
+std::size_t scan_neon(const char* text, std::size_t n, TextCounts& counts, std::uint64_t& word,
+                      std::uint64_t& sentence) {
+  const uint8x16_t low_table = vld1q_u8(kLowNibble.data());
+  const uint8x16_t high_table = vld1q_u8(kHighNibble.data());
+  TextCounts local;
+  std::uint64_t local_word = word;
+  std::uint64_t local_sentence = sentence;
+  std::size_t i = 0;
+  for (; i + kBlock <= n; i += kBlock) {
+    count_masks(classify_neon(text + i, low_table, high_table), local, local_word, local_sentence);
+  }
+  add_counts(counts, local);
+  word = local_word;
+  sentence = local_sentence;
+  return i;
+}
+
+std::uint64_t count_byte_neon(const char* text, std::size_t n, char byte) {
+  const uint8x16_t target = vdupq_n_u8(static_cast<std::uint8_t>(byte));
+  std::uint64_t count = 0;
+  std::size_t i = 0;
+  while (n - i >= 16) {
+    std::size_t end = i + (std::min<std::size_t>((n - i) / 16, 255) * 16);
+    uint8x16_t counters = vdupq_n_u8(0);
+    for (; i < end; i += 16) {
+      uint8x16_t v = vld1q_u8(reinterpret_cast<const std::uint8_t*>(text) + i);
+      counters = vsubq_u8(counters, vceqq_u8(v, target));
+    }
+    count += vaddlvq_u8(counters);
+  }
+  return count + count_byte_scalar(text + i, n - i, byte);
+}
+
+#endif
+
+}  // namespace
+
+ppc::core::TextCounts ppc::core::operator+(const TextCounts& block, const TextCounts& next) {
+  if (block.bytes == 0) {
+    return next;
+  }
+  if (next.bytes == 0) {
+    return block;
+  }
+  TextCounts sum;
+  sum.bytes = block.bytes + next.bytes;
+  sum.letters = block.letters + next.letters;
+  sum.spaces = block.spaces + next.spaces;
+  sum.terminators = block.terminators + next.terminators;
+  sum.words = block.words + next.words;
+  sum.sentences = block.sentences + next.sentences;
+  // a word or a run of terminators cut by the border was counted twice
+  if ((block.last & SPACE) == 0 && (next.first & SPACE) == 0) {
+    sum.words--;
+  }
+  if ((block.last & TERMINATOR) != 0 && (next.first & TERMINATOR) != 0) {
+    sum.sentences--;
+  }
+  sum.first = block.first;
+  sum.last = next.last;
+  return sum;
+}
+
+ppc::core::TextCounts ppc::core::scan_text(const char* text, std::size_t n, SimdLevel level) {
+  TextCounts counts;
+  if (n == 0) {
+    return counts;
+  }
+  counts.bytes = n;
+  counts.first = char_class(text[0]);
+  counts.last = char_class(text[n - 1]);
+  std::uint64_t word = 0;
+  std::uint64_t sentence = 0;
+  std::size_t i = 0;
+#ifdef PPC_SIMD_X86
+  // the 512-bit byte shuffle needs AVX512BW, all AVX-512 CPUs have AVX2
+  if (level == AVX512 && has_avx512bw()) {
+    i = scan_avx512(text, n, counts, word, sentence);
+  } else if (level == AVX2 || level == AVX512) {
+    i = scan_avx2(text, n, counts, word, sentence);
+  }
+#endif
+#ifdef PPC_SIMD_NEON
+  if (level == NEON) {
+    i = scan_neon(text, n, counts, word, sentence);
+  }
+#endif
+  scan_scalar(text + i, n - i, counts, word, sentence);
+  return counts;
+}
+
+std::uint64_t ppc::core::count_byte(const char* text, std::size_t n, char byte, SimdLevel level) {
+  switch (level) {
+#ifdef PPC_SIMD_X86
+    case AVX2:
+    case AVX512:
+      return count_byte_avx2(text, n, byte);
+#endif
+#ifdef PPC_SIMD_NEON
+    case NEON:
+      return count_byte_neon(text, n, byte);
+#endif
+    default:
+      return count_byte_scalar(text, n, byte);
+  }
+}
@@ -14,10 +14,23 @@ namespace ppc::core {
 
 struct TaskData {
   std::vector<uint8_t *> inputs;
-  std::vector<std::uint32_t> inputs_count;
+  std::vector<std::uint64_t> inputs_count;
   std::vector<uint8_t *> outputs;
-  std::vector<std::uint32_t> outputs_count;
+  std::vector<std::uint64_t> outputs_count;
   enum StateOfTesting { FUNC, PERF } state_of_testing;
+  // ranks that get the result of a parallel task: only the root, every rank
+  // (e.g. when the next task needs it everywhere) or every rank its own
+  // block of the outputs, described by outputs_offset/outputs_global_count
+  enum OutputPlacement { ROOT, ALL_RANKS, DISTRIBUTED } output_placement = ROOT;
+  // distributed data: inputs of every rank hold only its own block, blocks
+  // of inputs[i] start at inputs_offset[i] and together make up
+  // inputs_global_count[i] elements; outputs of every rank are described
+  // the same way, so they can be inputs of the next task as they are
+  bool distributed = false;
+  std::vector<std::uint64_t> inputs_offset;
+  std::vector<std::uint64_t> inputs_global_count;
+  std::vector<std::uint64_t> outputs_offset;
+  std::vector<std::uint64_t> outputs_global_count;
 };
 
 // Memory of inputs and outputs need to be initialized before create object of
@@ -46,6 +59,9 @@ class Task {
 
   virtual ~Task();
 
+  // function of the pipeline last entered by any task, used by profilers
+  [[nodiscard]] static const std::string &current_phase();
+
  protected:
   void internal_order_test(const std::string &str = __builtin_FUNCTION());
   std::shared_ptr<TaskData> taskData;
@@ -55,6 +71,7 @@ class Task {
   std::vector<std::string> right_functions_order = {"validation", "pre_processing", "run", "post_processing"};
   const double max_test_time = 1.0;
   std::chrono::high_resolution_clock::time_point tmp_time_point;
+  static std::string &phase();
 };
 
 }  // namespace ppc::core
@@ -17,6 +17,7 @@ std::shared_ptr<ppc::core::TaskData> ppc::core::Task::get_data() const { return
 ppc::core::Task::Task(std::shared_ptr<TaskData> taskData_) { set_data(std::move(taskData_)); }
 
 void ppc::core::Task::internal_order_test(const std::string& str) {
+  phase() = str;
   if (!functions_order.empty() && str == functions_order.back() && str == "run") return;
 
   functions_order.push_back(str);
@@ -45,3 +46,10 @@ void ppc::core::Task::internal_order_test(const std::string& str) {
 }
 
 ppc::core::Task::~Task() { functions_order.clear(); }
+
+const std::string& ppc::core::Task::current_phase() { return phase(); }
+
+std::string& ppc::core::Task::phase() {
+  static std::string current;
+  return current;
+}
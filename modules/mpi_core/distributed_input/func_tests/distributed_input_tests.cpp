@@ -0,0 +1,130 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "core/generator/include/generator.hpp"
+#include "mpi_core/distributed_input/func_tests/scale_task.hpp"
+#include "mpi_core/distributed_input/include/distributed_input.hpp"
+
+TEST(distributed_input_tests, check_blocks_match_whole_input) {
+  boost::mpi::communicator world;
+  ppc::core::CounterGenerator<int> gen(2024, -50, 50);
+  const std::uint64_t count = 1001;
+
+  std::vector<int> local;
+  ppc::core::TaskData taskData;
+  ppc::mpi::add_distributed_input(world, taskData, local, count, gen);
+
+  ASSERT_TRUE(taskData.distributed);
+  ASSERT_EQ(taskData.inputs_global_count[0], count);
+  ASSERT_EQ(taskData.inputs_count[0], local.size());
+
+  std::vector<int> sizes;
+  boost::mpi::gather(world, static_cast<int>(local.size()), sizes, 0);
+  std::vector<int> whole;
+  if (world.rank() == 0) {
+    whole.resize(count);
+    boost::mpi::gatherv(world, local.data(), static_cast<int>(local.size()), whole.data(), sizes, 0);
+    EXPECT_EQ(whole, gen.generate(0, count));
+  } else {
+    boost::mpi::gatherv(world, local.data(), static_cast<int>(local.size()), 0);
+  }
+}
+
+TEST(distributed_input_tests, check_offsets_are_contiguous) {
+  boost::mpi::communicator world;
+  ppc::core::CounterGenerator<double> gen(1, 0.0, 1.0);
+
+  std::vector<double> local;
+  ppc::core::TaskData taskData;
+  ppc::mpi::add_distributed_input(world, taskData, local, 10, gen);
+
+  std::uint64_t end = taskData.inputs_offset[0] + taskData.inputs_count[0];
+  std::uint64_t next_offset = 0;
+  if (world.rank() + 1 < world.size()) {
+    world.send(world.rank() + 1, 0, end);
+  }
+  if (world.rank() > 0) {
+    world.recv(world.rank() - 1, 0, next_offset);
+  }
+  EXPECT_EQ(taskData.inputs_offset[0], next_offset);
+}
+
+TEST(distributed_input_tests, check_resident_block_as_input) {
+  boost::mpi::communicator world;
+  // every rank owns 3 elements, as if read from its own file
+  std::vector<int> local = {world.rank() * 3, (world.rank() * 3) + 1, (world.rank() * 3) + 2};
+  ppc::core::TaskData taskData;
+  ppc::mpi::add_distributed_input(taskData, std::span<int>(local), world.rank() * 3, world.size() * 3);
+
+  auto block = ppc::mpi::input_block<int>(taskData, 0);
+  EXPECT_EQ(block.local.data(), local.data());
+  EXPECT_EQ(block.local.size(), 3U);
+  EXPECT_EQ(block.offset, static_cast<std::uint64_t>(world.rank() * 3));
+  EXPECT_EQ(block.global_count, static_cast<std::uint64_t>(world.size() * 3));
+}
+
+TEST(distributed_input_tests, check_gather_output) {
+  boost::mpi::communicator world;
+  const std::uint64_t count = 53;
+  ppc::mpi::LargeBlockPartition partition(count, world.size());
+  std::vector<int> local(partition.count(world.rank()));
+  for (std::uint64_t i = 0; i < local.size(); i++) {
+    local[i] = static_cast<int>(partition.offset(world.rank()) + i);
+  }
+  ppc::core::TaskData taskData;
+  ppc::mpi::add_distributed_output(taskData, std::span<int>(local), partition.offset(world.rank()), count);
+
+  auto whole = ppc::mpi::gather_output<int>(world, taskData, 0);
+  if (world.rank() == 0) {
+    ASSERT_EQ(whole.size(), count);
+    for (std::uint64_t i = 0; i < count; i++) {
+      EXPECT_EQ(whole[i], static_cast<int>(i));
+    }
+  } else {
+    EXPECT_TRUE(whole.empty());
+  }
+}
+
+TEST(distributed_input_tests, check_chained_tasks_keep_blocks_in_place) {
+  boost::mpi::communicator world;
+  ppc::core::CounterGenerator<int> gen(7, -100, 100);
+  const std::uint64_t count = 301;
+
+  // input -> x2 -> x3, outputs of the first task are inputs of the second
+  std::vector<int> in;
+  auto first = std::make_shared<ppc::core::TaskData>();
+  ppc::mpi::add_distributed_input(world, *first, in, count, gen);
+  std::vector<int> doubled(in.size());
+  ppc::mpi::add_distributed_output(*first, std::span<int>(doubled), first->inputs_offset[0], count);
+
+  auto second = std::make_shared<ppc::core::TaskData>();
+  ppc::mpi::chain_outputs(*first, *second);
+  std::vector<int> tripled(doubled.size());
+  ppc::mpi::add_distributed_output(*second, std::span<int>(tripled), second->inputs_offset[0], count);
+
+  ppc::test::ScaleTask doubling(first, 2);
+  ppc::test::ScaleTask tripling(second, 3);
+  for (auto* task : {&doubling, &tripling}) {
+    ASSERT_TRUE(task->validation());
+    task->pre_processing();
+    task->run();
+    task->post_processing();
+  }
+  EXPECT_EQ(second->inputs[0], reinterpret_cast<uint8_t*>(doubled.data()));
+
+  auto whole = ppc::mpi::gather_output<int>(world, *second, 0);
+  if (world.rank() == 0) {
+    auto reference = gen.generate(0, count);
+    ASSERT_EQ(whole.size(), count);
+    for (std::uint64_t i = 0; i < count; i++) {
+      EXPECT_EQ(whole[i], reference[i] * 6);
+    }
+  }
+}
@@ -0,0 +1,62 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_TESTS_SCALE_TASK_HPP_
+#define MODULES_MPI_CORE_TESTS_SCALE_TASK_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "core/task/include/task.hpp"
+#include "mpi_core/distributed_input/include/distributed_input.hpp"
+
+namespace ppc::test {
+
+// element-wise multiplication of a distributed vector by a factor, every
+// rank reads and writes only its own block
+class ScaleTask : public ppc::core::Task {
+ public:
+  ScaleTask(std::shared_ptr<ppc::core::TaskData> taskData_, int factor)
+      : Task(std::move(taskData_)), factor_(factor) {}
+
+  bool pre_processing() override {
+    internal_order_test();
+    input_ = ppc::mpi::input_block<int>(*taskData, 0);
+    output_ = ppc::mpi::output_block<int>(*taskData, 0);
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    // the output block of every rank matches its input block
+    bool local = taskData->distributed && taskData->inputs_count[0] == taskData->outputs_count[0] &&
+                 taskData->inputs_offset[0] == taskData->outputs_offset[0] &&
+                 taskData->inputs_global_count[0] == taskData->outputs_global_count[0];
+    return boost::mpi::all_reduce(world, local, std::logical_and<bool>());
+  }
+
+  bool run() override {
+    internal_order_test();
+    std::transform(input_.local.begin(), input_.local.end(), output_.local.begin(),
+                   [&](int value) { return value * factor_; });
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    return true;
+  }
+
+ private:
+  boost::mpi::communicator world;
+  int factor_;
+  ppc::mpi::DistributedBlock<const int> input_;
+  ppc::mpi::DistributedBlock<int> output_;
+};
+
+}  // namespace ppc::test
+
+#endif  // MODULES_MPI_CORE_TESTS_SCALE_TASK_HPP_
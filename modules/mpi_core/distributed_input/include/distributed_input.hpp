@@ -0,0 +1,123 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_DISTRIBUTED_INPUT_HPP_
+#define MODULES_MPI_CORE_INCLUDE_DISTRIBUTED_INPUT_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/generator/include/generator.hpp"
+#include "core/task/include/task.hpp"
+#include "mpi_core/large_count/include/large_count.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+
+namespace ppc::mpi {
+
+// Block of a distributed array owned by the current rank, local[0] is the
+// element `offset` of the array of `global_count` elements.
+template <class T>
+struct DistributedBlock {
+  std::span<T> local;
+  std::uint64_t offset{};
+  std::uint64_t global_count{};
+};
+
+// Adds to `taskData` a distributed input whose block is already resident on
+// the current rank, e.g. read from a per-rank file or produced by a
+// previous task. `local` must stay alive while the task runs.
+template <class T>
+void add_distributed_input(ppc::core::TaskData& taskData, std::span<T> local, std::uint64_t offset,
+                           std::uint64_t global_count) {
+  taskData.distributed = true;
+  taskData.inputs.emplace_back(reinterpret_cast<uint8_t*>(const_cast<std::remove_const_t<T>*>(local.data())));
+  taskData.inputs_count.emplace_back(local.size());
+  taskData.inputs_offset.emplace_back(offset);
+  taskData.inputs_global_count.emplace_back(global_count);
+}
+
+// Adds to `taskData` a distributed input of `global_count` elements where
+// every rank generates only its own block of the sequence into `storage`.
+// The blocks together are the same as gen.generate(0, global_count), so a
+// sequential reference can rebuild the whole input from the same seed.
+template <class T>
+void add_distributed_input(const boost::mpi::communicator& world, ppc::core::TaskData& taskData,
+                           std::vector<T>& storage, std::uint64_t global_count,
+                           const ppc::core::CounterGenerator<T>& gen) {
+  LargeBlockPartition partition(global_count, world.size());
+  storage = gen.generate(partition.offset(world.rank()), partition.count(world.rank()));
+  add_distributed_input(taskData, std::span<T>(storage), partition.offset(world.rank()), global_count);
+}
+
+// Adds to `taskData` an output the task writes only for the block owned by
+// the current rank.
+template <class T>
+void add_distributed_output(ppc::core::TaskData& taskData, std::span<T> local, std::uint64_t offset,
+                            std::uint64_t global_count) {
+  taskData.distributed = true;
+  taskData.outputs.emplace_back(reinterpret_cast<uint8_t*>(local.data()));
+  taskData.outputs_count.emplace_back(local.size());
+  taskData.outputs_offset.emplace_back(offset);
+  taskData.outputs_global_count.emplace_back(global_count);
+}
+
+template <class T>
+DistributedBlock<const T> input_block(const ppc::core::TaskData& taskData, std::size_t index) {
+  return {{reinterpret_cast<const T*>(taskData.inputs[index]), taskData.inputs_count[index]},
+          taskData.inputs_offset[index],
+          taskData.inputs_global_count[index]};
+}
+
+template <class T>
+DistributedBlock<T> output_block(const ppc::core::TaskData& taskData, std::size_t index) {
+  return {{reinterpret_cast<T*>(taskData.outputs[index]), taskData.outputs_count[index]},
+          taskData.outputs_offset[index],
+          taskData.outputs_global_count[index]};
+}
+
+// Adds the distributed outputs of `previous` as inputs of `next`, so the
+// next task starts from the blocks every rank already holds instead of a
+// gather to the root and a scatter back.
+inline void chain_outputs(const ppc::core::TaskData& previous, ppc::core::TaskData& next) {
+  next.distributed = true;
+  for (std::size_t i = 0; i < previous.outputs.size(); i++) {
+    next.inputs.emplace_back(previous.outputs[i]);
+    next.inputs_count.emplace_back(previous.outputs_count[i]);
+    next.inputs_offset.emplace_back(previous.outputs_offset[i]);
+    next.inputs_global_count.emplace_back(previous.outputs_global_count[i]);
+  }
+}
+
+// Whole distributed output `index` on the root, e.g. to check it against a
+// sequential reference; empty on other ranks.
+template <class T>
+std::vector<T> gather_output(const boost::mpi::communicator& world, const ppc::core::TaskData& taskData,
+                             std::size_t index, int root = 0) {
+  auto block = output_block<T>(taskData, index);
+  std::vector<std::uint64_t> offsets;
+  std::vector<std::uint64_t> counts;
+  boost::mpi::gather(world, block.offset, offsets, root);
+  boost::mpi::gather(world, static_cast<std::uint64_t>(block.local.size()), counts, root);
+  if (world.rank() != root) {
+    send_large(world, block.local.data(), block.local.size(), root, 0);
+    return {};
+  }
+  std::vector<T> whole(block.global_count);
+  for (int proc = 0; proc < world.size(); proc++) {
+    if (proc == root) {
+      std::copy(block.local.begin(), block.local.end(), whole.begin() + block.offset);
+    } else {
+      recv_large(world, whole.data() + offsets[proc], counts[proc], proc, 0);
+    }
+  }
+  return whole;
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_DISTRIBUTED_INPUT_HPP_
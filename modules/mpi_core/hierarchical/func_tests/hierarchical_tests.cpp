@@ -0,0 +1,85 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/operations.hpp>
+#include <functional>
+#include <vector>
+
+#include "mpi_core/hierarchical/include/hierarchical.hpp"
+
+TEST(hierarchical_tests, check_reduce) {
+  for (int node_size : {0, 2, 3}) {
+    ppc::mpi::HierarchicalCommunicator world(boost::mpi::communicator(), node_size);
+    int sum = 0;
+    // unqualified as in the tasks
+    reduce(world, world.rank() + 1, sum, std::plus<int>(), 0);
+    if (world.rank() == 0) {
+      EXPECT_EQ(sum, world.size() * (world.size() + 1) / 2);
+    }
+
+    std::vector<double> in = {1.0 * world.rank(), -1.0 * world.rank()};
+    std::vector<double> out(2);
+    reduce(world, in.data(), 2, out.data(), boost::mpi::maximum<double>(), 0);
+    if (world.rank() == 0) {
+      EXPECT_EQ(out[0], world.size() - 1);
+      EXPECT_EQ(out[1], 0.0);
+    }
+  }
+}
+
+TEST(hierarchical_tests, check_reduce_to_other_root) {
+  ppc::mpi::HierarchicalCommunicator world(boost::mpi::communicator(), 2);
+  int root = world.size() - 1;
+  int count = 0;
+  reduce(world, 1, count, std::plus<int>(), root);
+  if (world.rank() == root) {
+    EXPECT_EQ(count, world.size());
+  }
+}
+
+TEST(hierarchical_tests, check_all_reduce) {
+  ppc::mpi::HierarchicalCommunicator world(boost::mpi::communicator(), 2);
+  int min = 0;
+  all_reduce(world, 10 - world.rank(), min, boost::mpi::minimum<int>());
+  EXPECT_EQ(min, 10 - (world.size() - 1));
+}
+
+TEST(hierarchical_tests, check_gather_in_rank_order) {
+  for (int node_size : {2, 3}) {
+    ppc::mpi::HierarchicalCommunicator world(boost::mpi::communicator(), node_size);
+    std::vector<int> in = {world.rank(), world.rank() * 10};
+    std::vector<int> out;
+    gather(world, in.data(), 2, out, 0);
+    if (world.rank() == 0) {
+      ASSERT_EQ(static_cast<int>(out.size()), 2 * world.size());
+      for (int rank = 0; rank < world.size(); rank++) {
+        EXPECT_EQ(out[2 * rank], rank);
+        EXPECT_EQ(out[2 * rank + 1], rank * 10);
+      }
+    }
+  }
+}
+
+TEST(hierarchical_tests, check_scatter_in_rank_order) {
+  for (int node_size : {2, 3}) {
+    ppc::mpi::HierarchicalCommunicator world(boost::mpi::communicator(), node_size);
+    std::vector<int> in;
+    if (world.rank() == 0) {
+      for (int rank = 0; rank < world.size(); rank++) {
+        in.push_back(rank * 3);
+      }
+    }
+    int out = -1;
+    scatter(world, in, out, 0);
+    EXPECT_EQ(out, world.rank() * 3);
+  }
+}
+
+TEST(hierarchical_tests, check_boost_collectives_still_work) {
+  ppc::mpi::HierarchicalCommunicator world(boost::mpi::communicator(), 2);
+  int value = world.rank() == 0 ? 42 : 0;
+  broadcast(world, value, 0);
+  EXPECT_EQ(value, 42);
+}
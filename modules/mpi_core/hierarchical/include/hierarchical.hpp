@@ -0,0 +1,239 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_HIERARCHICAL_HPP_
+#define MODULES_MPI_CORE_INCLUDE_HIERARCHICAL_HPP_
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/operations.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "mpi_core/topology/include/topology.hpp"
+
+namespace ppc::mpi {
+
+// Communicator that runs collectives in two levels: inside every node and
+// then between node leaders, so only one message per node crosses the
+// network. The node and leader communicators are built once, by the first
+// collective that needs them. It is a boost::mpi::communicator, so it can
+// replace one in a task: unqualified reduce/all_reduce/gather/scatter calls
+// pick the overloads below, everything else works as before.
+class HierarchicalCommunicator : public boost::mpi::communicator {
+ public:
+  // emulated_node_size > 0 groups consecutive ranks into fake nodes (for
+  // testing), see NodeTopology
+  explicit HierarchicalCommunicator(const boost::mpi::communicator& comm = boost::mpi::communicator(),
+                                    int emulated_node_size = 0)
+      : boost::mpi::communicator(comm), emulated_node_size_(emulated_node_size) {}
+
+  // collective on the first call
+  [[nodiscard]] const NodeTopology& topology() const;
+
+  // whether a collective with `root` goes through the leaders; otherwise
+  // it is a flat collective over the whole communicator
+  [[nodiscard]] bool hierarchical(int root) const;
+  template <class Op, class T>
+  [[nodiscard]] bool hierarchical(int root) const {
+    // the order of combination changes, so only for commutative operations
+    return (boost::mpi::is_mpi_op<Op, T>::value || boost::mpi::is_commutative<Op, T>::value) && hierarchical(root);
+  }
+
+  [[nodiscard]] const boost::mpi::communicator& flat() const { return *this; }
+
+ private:
+  int emulated_node_size_;
+  mutable std::shared_ptr<NodeTopology> topology_;
+};
+
+template <class T, class Op>
+void reduce(const HierarchicalCommunicator& comm, const T* in_values, int n, T* out_values, Op op, int root) {
+  if (!comm.hierarchical<Op, T>(root)) {
+    if (comm.rank() == root) {
+      boost::mpi::reduce(comm.flat(), in_values, n, out_values, op, root);
+    } else {
+      boost::mpi::reduce(comm.flat(), in_values, n, op, root);
+    }
+    return;
+  }
+  const auto& topology = comm.topology();
+  if (!topology.is_leader()) {
+    boost::mpi::reduce(topology.node(), in_values, n, op, 0);
+    return;
+  }
+  std::vector<T> node_values(n);
+  boost::mpi::reduce(topology.node(), in_values, n, node_values.data(), op, 0);
+  if (comm.rank() == root) {
+    boost::mpi::reduce(topology.leaders(), node_values.data(), n, out_values, op, 0);
+  } else {
+    boost::mpi::reduce(topology.leaders(), node_values.data(), n, op, 0);
+  }
+}
+
+template <class T, class Op>
+void reduce(const HierarchicalCommunicator& comm, const T* in_values, int n, Op op, int root) {
+  reduce(comm, in_values, n, static_cast<T*>(nullptr), op, root);
+}
+
+// out_value is significant only on the root
+template <class T, class Op>
+void reduce(const HierarchicalCommunicator& comm, const T& in_value, T& out_value, Op op, int root) {
+  reduce(comm, &in_value, 1, &out_value, op, root);
+}
+
+template <class T, class Op>
+void reduce(const HierarchicalCommunicator& comm, const T& in_value, Op op, int root) {
+  reduce(comm, &in_value, 1, static_cast<T*>(nullptr), op, root);
+}
+
+template <class T, class Op>
+void all_reduce(const HierarchicalCommunicator& comm, const T* in_values, int n, T* out_values, Op op) {
+  if (!comm.hierarchical<Op, T>(0)) {
+    boost::mpi::all_reduce(comm.flat(), in_values, n, out_values, op);
+    return;
+  }
+  const auto& topology = comm.topology();
+  if (topology.is_leader()) {
+    std::vector<T> node_values(n);
+    boost::mpi::reduce(topology.node(), in_values, n, node_values.data(), op, 0);
+    boost::mpi::all_reduce(topology.leaders(), node_values.data(), n, out_values, op);
+  } else {
+    boost::mpi::reduce(topology.node(), in_values, n, op, 0);
+  }
+  boost::mpi::broadcast(topology.node(), out_values, n, 0);
+}
+
+template <class T, class Op>
+void all_reduce(const HierarchicalCommunicator& comm, const T& in_value, T& out_value, Op op) {
+  all_reduce(comm, &in_value, 1, &out_value, op);
+}
+
+// blocks of n values of every rank in rank order, out_values is
+// significant only on the root
+template <class T>
+void gather(const HierarchicalCommunicator& comm, const T* in_values, int n, T* out_values, int root) {
+  if (!comm.hierarchical(root)) {
+    if (comm.rank() == root) {
+      boost::mpi::gather(comm.flat(), in_values, n, out_values, root);
+    } else {
+      boost::mpi::gather(comm.flat(), in_values, n, root);
+    }
+    return;
+  }
+  const auto& topology = comm.topology();
+  if (!topology.is_leader()) {
+    boost::mpi::gather(topology.node(), in_values, n, 0);
+    return;
+  }
+  std::vector<T> node_values(static_cast<std::size_t>(topology.node().size()) * n);
+  boost::mpi::gather(topology.node(), in_values, n, node_values.data(), 0);
+  if (comm.rank() != root) {
+    boost::mpi::gatherv(topology.leaders(), node_values.data(), static_cast<int>(node_values.size()), 0);
+    return;
+  }
+
+  // blocks arrive grouped by node, put them back in rank order
+  const auto& nodes = topology.nodes();
+  std::vector<int> sizes(nodes.size());
+  std::vector<int> displs(nodes.size());
+  for (std::size_t node = 0; node < nodes.size(); node++) {
+    sizes[node] = static_cast<int>(nodes[node].size()) * n;
+    displs[node] = node == 0 ? 0 : displs[node - 1] + sizes[node - 1];
+  }
+  std::vector<T> by_node(static_cast<std::size_t>(comm.size()) * n);
+  boost::mpi::gatherv(topology.leaders(), node_values.data(), static_cast<int>(node_values.size()), by_node.data(),
+                      sizes, displs, 0);
+  auto block = by_node.begin();
+  for (const auto& members : nodes) {
+    for (int rank : members) {
+      std::copy(block, block + n, out_values + static_cast<std::size_t>(rank) * n);
+      block += n;
+    }
+  }
+}
+
+template <class T>
+void gather(const HierarchicalCommunicator& comm, const T* in_values, int n, std::vector<T>& out_values, int root) {
+  if (comm.rank() == root) {
+    out_values.resize(static_cast<std::size_t>(comm.size()) * n);
+  }
+  gather(comm, in_values, n, out_values.data(), root);
+}
+
+template <class T>
+void gather(const HierarchicalCommunicator& comm, const T& in_value, std::vector<T>& out_values, int root) {
+  gather(comm, &in_value, 1, out_values, root);
+}
+
+template <class T>
+void gather(const HierarchicalCommunicator& comm, const T& in_value, T* out_values, int root) {
+  gather(comm, &in_value, 1, out_values, root);
+}
+
+template <class T>
+void gather(const HierarchicalCommunicator& comm, const T& in_value, int root) {
+  gather(comm, &in_value, 1, static_cast<T*>(nullptr), root);
+}
+
+// blocks of n values in rank order from the root, in_values is significant
+// only on the root
+template <class T>
+void scatter(const HierarchicalCommunicator& comm, const T* in_values, T* out_values, int n, int root) {
+  if (!comm.hierarchical(root)) {
+    if (comm.rank() == root) {
+      boost::mpi::scatter(comm.flat(), in_values, out_values, n, root);
+    } else {
+      boost::mpi::scatter(comm.flat(), out_values, n, root);
+    }
+    return;
+  }
+  const auto& topology = comm.topology();
+  std::vector<T> node_values;
+  if (topology.is_leader()) {
+    node_values.resize(static_cast<std::size_t>(topology.node().size()) * n);
+    if (comm.rank() == root) {
+      // group the blocks by node
+      const auto& nodes = topology.nodes();
+      std::vector<T> by_node;
+      by_node.reserve(static_cast<std::size_t>(comm.size()) * n);
+      std::vector<int> sizes(nodes.size());
+      std::vector<int> displs(nodes.size());
+      for (std::size_t node = 0; node < nodes.size(); node++) {
+        sizes[node] = static_cast<int>(nodes[node].size()) * n;
+        displs[node] = static_cast<int>(by_node.size());
+        for (int rank : nodes[node]) {
+          by_node.insert(by_node.end(), in_values + static_cast<std::size_t>(rank) * n,
+                         in_values + static_cast<std::size_t>(rank + 1) * n);
+        }
+      }
+      boost::mpi::scatterv(topology.leaders(), by_node.data(), sizes, displs, node_values.data(),
+                           static_cast<int>(node_values.size()), 0);
+    } else {
+      boost::mpi::scatterv(topology.leaders(), node_values.data(), static_cast<int>(node_values.size()), 0);
+    }
+    boost::mpi::scatter(topology.node(), node_values.data(), out_values, n, 0);
+  } else {
+    boost::mpi::scatter(topology.node(), out_values, n, 0);
+  }
+}
+
+template <class T>
+void scatter(const HierarchicalCommunicator& comm, const std::vector<T>& in_values, T& out_value, int root) {
+  scatter(comm, in_values.data(), &out_value, 1, root);
+}
+
+template <class T>
+void scatter(const HierarchicalCommunicator& comm, const T* in_values, T& out_value, int root) {
+  scatter(comm, in_values, &out_value, 1, root);
+}
+
+template <class T>
+void scatter(const HierarchicalCommunicator& comm, T& out_value, int root) {
+  scatter(comm, static_cast<const T*>(nullptr), &out_value, 1, root);
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_HIERARCHICAL_HPP_
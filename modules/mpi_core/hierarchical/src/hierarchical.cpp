@@ -0,0 +1,16 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi_core/hierarchical/include/hierarchical.hpp"
+
+#include <memory>
+
+const ppc::mpi::NodeTopology& ppc::mpi::HierarchicalCommunicator::topology() const {
+  if (!topology_) {
+    topology_ = std::make_shared<NodeTopology>(*this, 0, emulated_node_size_);
+  }
+  return *topology_;
+}
+
+bool ppc::mpi::HierarchicalCommunicator::hierarchical(int root) const {
+  // with a single node or a rank per node the second level adds nothing
+  return root == 0 && size() > 2 && topology().num_nodes() > 1 && topology().num_nodes() < size();
+}
@@ -0,0 +1,152 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "mpi_core/large_count/include/large_count.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
+
+namespace {
+
+std::uint8_t value_at(std::uint64_t i) { return static_cast<std::uint8_t>(i % 251); }
+
+}  // namespace
+
+TEST(large_count_tests, check_chunks_cover_count) {
+  std::vector<int> chunks;
+  std::uint64_t next = 0;
+  ppc::mpi::for_each_chunk(10, 4, [&](std::uint64_t offset, int n) {
+    EXPECT_EQ(offset, next);
+    next += n;
+    chunks.push_back(n);
+  });
+  EXPECT_EQ(chunks, std::vector<int>({4, 4, 2}));
+  ppc::mpi::for_each_chunk(0, 4, [&](std::uint64_t, int) { ADD_FAILURE(); });
+}
+
+TEST(large_count_tests, check_send_recv_in_chunks) {
+  boost::mpi::communicator world;
+  if (world.size() < 2) {
+    GTEST_SKIP();
+  }
+  std::vector<int> data(1003);
+  if (world.rank() == 0) {
+    std::iota(data.begin(), data.end(), 0);
+    ppc::mpi::send_large(world, data.data(), data.size(), 1, 0, 100);
+  } else if (world.rank() == 1) {
+    ppc::mpi::recv_large(world, data.data(), data.size(), 0, 0, 100);
+    for (int i = 0; i < static_cast<int>(data.size()); i++) {
+      EXPECT_EQ(data[i], i);
+    }
+  }
+}
+
+TEST(large_count_tests, check_broadcast_in_chunks) {
+  boost::mpi::communicator world;
+  std::vector<double> data(777);
+  if (world.rank() == 0) {
+    std::iota(data.begin(), data.end(), 0.5);
+  }
+  ppc::mpi::broadcast_large(world, data.data(), data.size(), 0, 64);
+  for (int i = 0; i < static_cast<int>(data.size()); i++) {
+    EXPECT_EQ(data[i], i + 0.5);
+  }
+}
+
+TEST(large_count_tests, check_scatter_view_in_chunks) {
+  boost::mpi::communicator world;
+  const std::uint64_t count = 1000;
+  std::vector<int> data;
+  if (world.rank() == 0) {
+    data.resize(count);
+    std::iota(data.begin(), data.end(), 0);
+  }
+  ppc::mpi::LargeBlockPartition partition(count, world.size());
+  std::vector<int> storage;
+  auto local = ppc::mpi::scatter_view(world, data.data(), partition, storage, 0, 30);
+
+  ASSERT_EQ(local.size(), partition.count(world.rank()));
+  for (std::uint64_t i = 0; i < local.size(); i++) {
+    EXPECT_EQ(local[i], static_cast<int>(partition.offset(world.rank()) + i));
+  }
+}
+
+TEST(large_count_tests, check_scatter_view_keeps_given_blocks) {
+  boost::mpi::communicator world;
+  // uneven blocks whose total fits int go through MPI_Scatterv, with the given counts and not an even split
+  ppc::mpi::LargeBlockPartition partition(0, world.size());
+  std::uint64_t total = 0;
+  for (int proc = 0; proc < world.size(); proc++) {
+    partition.counts[proc] = 3 * static_cast<std::uint64_t>(world.size() - proc);
+    partition.displs[proc] = total;
+    total += partition.counts[proc];
+  }
+  std::vector<int> data;
+  if (world.rank() == 0) {
+    data.resize(total);
+    std::iota(data.begin(), data.end(), 0);
+  }
+  std::vector<int> storage;
+  auto local = ppc::mpi::scatter_view(world, data.data(), partition, storage);
+
+  ASSERT_EQ(local.size(), partition.count(world.rank()));
+  for (std::uint64_t i = 0; i < local.size(); i++) {
+    EXPECT_EQ(local[i], static_cast<int>(partition.offset(world.rank()) + i));
+  }
+}
+
+TEST(large_count_tests, check_scatter_input_beyond_int) {
+  boost::mpi::communicator world;
+  const std::uint64_t count = (std::uint64_t{1} << 31) + 7;
+
+  // takes gigabytes and minutes, so it runs only when PPC_LARGE_TESTS is set
+  bool enabled = world.rank() == 0 && std::getenv("PPC_LARGE_TESTS") != nullptr;
+  boost::mpi::broadcast(world, enabled, 0);
+  if (!enabled) {
+    GTEST_SKIP() << "set PPC_LARGE_TESTS to run it";
+  }
+
+  // the root holds the whole input and the other ranks their blocks
+  bool enough_memory = false;
+  if (world.rank() == 0) {
+    std::uint64_t available =
+        static_cast<std::uint64_t>(sysconf(_SC_AVPHYS_PAGES)) * static_cast<std::uint64_t>(sysconf(_SC_PAGE_SIZE));
+    enough_memory = available > 2 * count + (std::uint64_t{1} << 28);
+  }
+  boost::mpi::broadcast(world, enough_memory, 0);
+  if (!enough_memory) {
+    GTEST_SKIP() << "not enough memory for an input of " << count << " bytes";
+  }
+
+  std::vector<std::uint8_t> in;
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    in.resize(count);
+    for (std::uint64_t i = 0; i < count; i++) {
+      in[i] = value_at(i);
+    }
+    taskData->inputs.emplace_back(in.data());
+    taskData->inputs_count.emplace_back(in.size());
+  }
+
+  std::vector<std::uint8_t> storage;
+  auto local = ppc::mpi::scatter_input<std::uint8_t>(world, *taskData, storage);
+
+  ppc::mpi::LargeBlockPartition partition(count, world.size());
+  ASSERT_EQ(local.size(), partition.count(world.rank()));
+  std::uint64_t mismatches = 0;
+  for (std::uint64_t i = 0; i < local.size(); i++) {
+    mismatches += local[i] != value_at(partition.offset(world.rank()) + i) ? 1 : 0;
+  }
+  EXPECT_EQ(mismatches, 0U);
+}
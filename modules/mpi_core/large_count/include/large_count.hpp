@@ -0,0 +1,56 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_LARGE_COUNT_HPP_
+#define MODULES_MPI_CORE_INCLUDE_LARGE_COUNT_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <climits>
+#include <cstdint>
+
+namespace ppc::mpi {
+
+// Counts of MPI calls are int, so transfers of more elements are split
+// into chunks of at most `max_chunk` elements. The chunk size is a
+// parameter only to test the splitting on small data.
+inline constexpr std::uint64_t kMaxCount = INT_MAX;
+
+// call(offset, n) for consecutive chunks of `count` elements
+template <class Call>
+void for_each_chunk(std::uint64_t count, std::uint64_t max_chunk, Call&& call) {
+  for (std::uint64_t offset = 0; offset < count; offset += max_chunk) {
+    call(offset, static_cast<int>(std::min(max_chunk, count - offset)));
+  }
+}
+
+template <class T>
+void send_large(const boost::mpi::communicator& comm, const T* data, std::uint64_t count, int dest, int tag,
+                std::uint64_t max_chunk = kMaxCount) {
+  for_each_chunk(count, max_chunk, [&](std::uint64_t offset, int n) {
+    MPI_Send(data + offset, n, boost::mpi::get_mpi_datatype<T>(), dest, tag, comm);
+  });
+}
+
+// `count` must be the same as sent, the chunks are matched in order
+template <class T>
+void recv_large(const boost::mpi::communicator& comm, T* data, std::uint64_t count, int source, int tag,
+                std::uint64_t max_chunk = kMaxCount) {
+  for_each_chunk(count, max_chunk, [&](std::uint64_t offset, int n) {
+    MPI_Recv(data + offset, n, boost::mpi::get_mpi_datatype<T>(), source, tag, comm, MPI_STATUS_IGNORE);
+  });
+}
+
+template <class T>
+void broadcast_large(const boost::mpi::communicator& comm, T* data, std::uint64_t count, int root,
+                     std::uint64_t max_chunk = kMaxCount) {
+  for_each_chunk(count, max_chunk, [&](std::uint64_t offset, int n) {
+    MPI_Bcast(data + offset, n, boost::mpi::get_mpi_datatype<T>(), root, comm);
+  });
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_LARGE_COUNT_HPP_
@@ -0,0 +1,92 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <vector>
+
+#include "mpi_core/matrix_distribution/include/matrix_distribution.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+
+namespace {
+
+int value_at(int row, int col) { return (row * 100) + col; }
+
+// row-major rows x cols matrix on the root, empty elsewhere
+std::vector<int> make_matrix(const boost::mpi::communicator& world, int rows, int cols) {
+  std::vector<int> matrix;
+  if (world.rank() == 0) {
+    matrix.resize(rows * cols);
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < cols; j++) {
+        matrix[(i * cols) + j] = value_at(i, j);
+      }
+    }
+  }
+  return matrix;
+}
+
+}  // namespace
+
+TEST(matrix_distribution_tests, check_column_blocks_are_column_major) {
+  boost::mpi::communicator world;
+  const int rows = 7;
+  const int cols = 10;
+  auto matrix = make_matrix(world, rows, cols);
+
+  ppc::mpi::BlockPartition columns(cols, world.size());
+  std::vector<int> local;
+  ppc::mpi::scatter_column_blocks(world, matrix.data(), rows, cols, columns, local);
+
+  int own = columns.count(world.rank());
+  ASSERT_EQ(static_cast<int>(local.size()), own * rows);
+  for (int c = 0; c < own; c++) {
+    for (int i = 0; i < rows; i++) {
+      EXPECT_EQ(local[(c * rows) + i], value_at(i, columns.offset(world.rank()) + c));
+    }
+  }
+}
+
+TEST(matrix_distribution_tests, check_grid_tiles_are_row_major) {
+  boost::mpi::communicator world;
+  const int rows = 9;
+  const int cols = 11;
+  auto matrix = make_matrix(world, rows, cols);
+
+  int grid_cols = 1;
+  for (int d = 1; d * d <= world.size(); d++) {
+    if (world.size() % d == 0) {
+      grid_cols = d;
+    }
+  }
+  int grid_rows = world.size() / grid_cols;
+  std::vector<int> local;
+  auto tile = ppc::mpi::scatter_tiles(
+      world, matrix.data(), rows, cols,
+      [&](int rank) { return ppc::mpi::grid_tile(rows, cols, grid_rows, grid_cols, rank); }, local);
+
+  ASSERT_EQ(static_cast<int>(local.size()), tile.rows * tile.cols);
+  for (int i = 0; i < tile.rows; i++) {
+    for (int j = 0; j < tile.cols; j++) {
+      EXPECT_EQ(local[(i * tile.cols) + j], value_at(tile.row_begin + i, tile.col_begin + j));
+    }
+  }
+}
+
+TEST(matrix_distribution_tests, check_tiles_with_empty_blocks) {
+  boost::mpi::communicator world;
+  const int rows = 2;
+  const int cols = 3;
+  auto matrix = make_matrix(world, rows, cols);
+
+  // one row block per rank, with more than two ranks some of them get nothing
+  std::vector<int> local;
+  auto tile = ppc::mpi::scatter_tiles(
+      world, matrix.data(), rows, cols,
+      [&](int rank) { return ppc::mpi::grid_tile(rows, cols, world.size(), 1, rank); }, local);
+
+  EXPECT_EQ(tile.rows, ppc::mpi::BlockPartition(rows, world.size()).count(world.rank()));
+  ASSERT_EQ(static_cast<int>(local.size()), tile.rows * cols);
+  for (int j = 0; j < static_cast<int>(local.size()); j++) {
+    EXPECT_EQ(local[j], value_at(tile.row_begin + (j / cols), j % cols));
+  }
+}
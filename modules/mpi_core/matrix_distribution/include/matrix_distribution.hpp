@@ -0,0 +1,123 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_MATRIX_DISTRIBUTION_HPP_
+#define MODULES_MPI_CORE_INCLUDE_MATRIX_DISTRIBUTION_HPP_
+
+#include <mpi.h>
+
+#include <array>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstddef>
+#include <vector>
+
+#include "mpi_core/partition/include/partition.hpp"
+
+namespace ppc::mpi {
+
+// Derived MPI datatype freed when it goes out of scope.
+class DerivedDatatype {
+ public:
+  explicit DerivedDatatype(MPI_Datatype type) : type_(type) { MPI_Type_commit(&type_); }
+  DerivedDatatype(const DerivedDatatype&) = delete;
+  DerivedDatatype& operator=(const DerivedDatatype&) = delete;
+  ~DerivedDatatype() { MPI_Type_free(&type_); }
+
+  [[nodiscard]] MPI_Datatype get() const { return type_; }
+
+ private:
+  MPI_Datatype type_;
+};
+
+// One column of a row-major rows x cols matrix of T, resized to the extent
+// of one element so consecutive columns start one element apart.
+template <class T>
+MPI_Datatype column_type(int rows, int cols) {
+  MPI_Datatype column;
+  MPI_Datatype resized;
+  MPI_Type_vector(rows, 1, cols, boost::mpi::get_mpi_datatype<T>(), &column);
+  MPI_Type_create_resized(column, 0, sizeof(T), &resized);
+  MPI_Type_free(&column);
+  return resized;
+}
+
+// Rows [row_begin, row_begin + rows) and columns [col_begin, col_begin + cols)
+// of a matrix.
+struct MatrixTile {
+  int row_begin{};
+  int rows{};
+  int col_begin{};
+  int cols{};
+};
+
+// Tile of `rank` when a rows x cols matrix is split into a grid_rows x
+// grid_cols grid of blocks, ranks go through the grid row by row.
+inline MatrixTile grid_tile(int rows, int cols, int grid_rows, int grid_cols, int rank) {
+  BlockPartition row_blocks(rows, grid_rows);
+  BlockPartition col_blocks(cols, grid_cols);
+  int r = rank / grid_cols;
+  int c = rank % grid_cols;
+  return {row_blocks.offset(r), row_blocks.count(r), col_blocks.offset(c), col_blocks.count(c)};
+}
+
+// Scatters column blocks of the row-major rows x cols `matrix` (significant
+// only on the root) with a single MPI_Scatterv over a strided column type,
+// the root packs nothing. Rank r gets the columns of block r of `columns`,
+// stored column-major in `local`: every local column is contiguous.
+// `rows` and `cols` must be the same on all ranks.
+template <class T>
+void scatter_column_blocks(const boost::mpi::communicator& world, const T* matrix, int rows, int cols,
+                           const BlockPartition& columns, std::vector<T>& local, int root = 0) {
+  DerivedDatatype column(column_type<T>(rows, cols));
+  int rank = world.rank();
+  local.resize(static_cast<std::size_t>(columns.count(rank)) * rows);
+  MPI_Scatterv(matrix, columns.counts.data(), columns.displs.data(), column.get(), local.data(),
+               static_cast<int>(local.size()), boost::mpi::get_mpi_datatype<T>(), root, world);
+}
+
+// Scatters 2-D tiles of the row-major rows x cols `matrix` (significant
+// only on the root): the root sends every rank its tile straight from the
+// matrix with a subarray type, every rank gets its tile row-major and
+// contiguous in `local`. `tile_of(rank)` must give the same tiles on all
+// ranks.
+template <class T, class TileOf>
+MatrixTile scatter_tiles(const boost::mpi::communicator& world, const T* matrix, int rows, int cols, TileOf&& tile_of,
+                         std::vector<T>& local, int root = 0) {
+  MPI_Datatype element = boost::mpi::get_mpi_datatype<T>();
+  MatrixTile own = tile_of(world.rank());
+  local.resize(static_cast<std::size_t>(own.rows) * own.cols);
+  std::vector<MPI_Request> requests(1);
+  requests.reserve(world.size() + 1);
+  MPI_Irecv(local.data(), static_cast<int>(local.size()), element, root, 0, world, requests.data());
+  if (world.rank() == root) {
+    std::vector<MPI_Datatype> types;
+    for (int proc = 0; proc < world.size(); proc++) {
+      MatrixTile tile = tile_of(proc);
+      requests.emplace_back();
+      if (tile.rows == 0 || tile.cols == 0) {
+        // subarrays can't be empty
+        MPI_Isend(matrix, 0, element, proc, 0, world, &requests.back());
+        continue;
+      }
+      std::array<int, 2> sizes = {rows, cols};
+      std::array<int, 2> subsizes = {tile.rows, tile.cols};
+      std::array<int, 2> starts = {tile.row_begin, tile.col_begin};
+      types.emplace_back();
+      MPI_Type_create_subarray(2, sizes.data(), subsizes.data(), starts.data(), MPI_ORDER_C, element, &types.back());
+      MPI_Type_commit(&types.back());
+      MPI_Isend(matrix, 1, types.back(), proc, 0, world, &requests.back());
+    }
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    for (auto& type : types) {
+      MPI_Type_free(&type);
+    }
+  } else {
+    MPI_Wait(requests.data(), MPI_STATUS_IGNORE);
+  }
+  return own;
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_MATRIX_DISTRIBUTION_HPP_
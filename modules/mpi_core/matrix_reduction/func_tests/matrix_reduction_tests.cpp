@@ -0,0 +1,100 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
+#include "core/task/include/task.hpp"
+#include "mpi_core/matrix_reduction/include/matrix_reduction.hpp"
+
+namespace {
+
+// rows x cols matrix with a[i][j] = (i * 7 + j * 13) % 101 on the root, empty elsewhere
+ppc::core::Matrix<int> make_matrix(const boost::mpi::communicator& world, std::size_t rows, std::size_t cols) {
+  if (world.rank() != 0) {
+    return {};
+  }
+  ppc::core::Matrix<int> matrix(rows, cols);
+  for (std::size_t i = 0; i < rows; i++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      matrix(i, j) = static_cast<int>(((i * 7) + (j * 13)) % 101);
+    }
+  }
+  return matrix;
+}
+
+}  // namespace
+
+TEST(matrix_reduction_tests, check_all_axes_match_sequential) {
+  boost::mpi::communicator world;
+  // fewer rows than ranks leaves some ranks without rows
+  for (std::size_t rows : {static_cast<std::size_t>(1), static_cast<std::size_t>(2 * world.size() + 3)}) {
+    auto matrix = make_matrix(world, rows, 6);
+    ppc::core::TaskData taskData;
+    for (auto axis : {ppc::core::BY_ROW, ppc::core::BY_COLUMN, ppc::core::TOTAL}) {
+      std::vector<int> max;
+      std::vector<std::int64_t> sum;
+      ppc::mpi::reduce_matrix<ppc::core::MAX, int>(world, taskData, matrix, axis, max);
+      ppc::mpi::reduce_matrix<ppc::core::SUM, std::int64_t>(world, taskData, matrix, axis, sum);
+      if (world.rank() == 0) {
+        std::vector<int> expected_max;
+        std::vector<std::int64_t> expected_sum;
+        ppc::core::reduce_matrix<ppc::core::MAX>(matrix, axis, expected_max);
+        ppc::core::reduce_matrix<ppc::core::SUM>(matrix, axis, expected_sum);
+        EXPECT_EQ(max, expected_max) << rows << " " << axis;
+        EXPECT_EQ(sum, expected_sum) << rows << " " << axis;
+      }
+    }
+  }
+}
+
+TEST(matrix_reduction_tests, check_all_ranks_placement) {
+  boost::mpi::communicator world;
+  auto matrix = make_matrix(world, 5, 4);
+  ppc::core::TaskData taskData;
+  taskData.output_placement = ppc::core::TaskData::ALL_RANKS;
+  std::vector<int> mins;
+  ppc::mpi::reduce_matrix<ppc::core::MIN, int>(world, taskData, matrix, ppc::core::BY_ROW, mins);
+  std::vector<int> expected(5);
+  for (std::size_t i = 0; i < expected.size(); i++) {
+    int min = 101;
+    for (std::size_t j = 0; j < 4; j++) {
+      min = std::min(min, static_cast<int>(((i * 7) + (j * 13)) % 101));
+    }
+    expected[i] = min;
+  }
+  EXPECT_EQ(mins, expected);
+}
+
+TEST(matrix_reduction_tests, check_arg_reduce_uses_global_positions) {
+  boost::mpi::communicator world;
+  for (std::size_t rows : {static_cast<std::size_t>(1), static_cast<std::size_t>(2 * world.size() + 3)}) {
+    auto matrix = make_matrix(world, rows, 6);
+    ppc::core::TaskData taskData;
+    taskData.output_placement = ppc::core::TaskData::ALL_RANKS;
+    auto min = ppc::mpi::arg_reduce_matrix<ppc::core::MIN>(world, taskData, matrix);
+    auto max = ppc::mpi::arg_reduce_matrix<ppc::core::MAX>(world, taskData, matrix);
+
+    // the same values with the first position of each, on every rank
+    std::uint64_t first_min = 0;
+    std::uint64_t first_max = 0;
+    for (std::uint64_t k = 0; k < rows * 6; k++) {
+      int value = static_cast<int>(((k / 6 * 7) + (k % 6 * 13)) % 101);
+      int best_min = static_cast<int>(((first_min / 6 * 7) + (first_min % 6 * 13)) % 101);
+      int best_max = static_cast<int>(((first_max / 6 * 7) + (first_max % 6 * 13)) % 101);
+      first_min = value < best_min ? k : first_min;
+      first_max = value > best_max ? k : first_max;
+    }
+    EXPECT_EQ(min.index, first_min) << rows;
+    EXPECT_EQ(max.index, first_max) << rows;
+    if (world.rank() == 0) {
+      EXPECT_EQ(min.value, matrix(first_min / 6, first_min % 6));
+      EXPECT_EQ(max.value, matrix(first_max / 6, first_max % 6));
+    }
+  }
+}
@@ -0,0 +1,125 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_MATRIX_REDUCTION_HPP_
+#define MODULES_MPI_CORE_INCLUDE_MATRIX_REDUCTION_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/operations.hpp>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
+#include "core/task/include/task.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/result_placement/include/result_placement.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
+
+// Extrema are sent as one MPI struct type of their value and position.
+namespace boost::serialization {
+template <class Archive, class T>
+void serialize(Archive& ar, ppc::core::Extremum<T>& extremum, const unsigned int /*version*/) {
+  ar & extremum.value;
+  ar & extremum.index;
+}
+}  // namespace boost::serialization
+
+namespace boost::mpi {
+template <class T>
+struct is_mpi_datatype<ppc::core::Extremum<T>> : is_mpi_datatype<T> {};
+}  // namespace boost::mpi
+
+namespace ppc::mpi {
+
+// MPI operation of a reduction, a predefined one for built-in types
+template <ppc::core::Reduction Op, class Acc>
+auto reduction_op() {
+  if constexpr (Op == ppc::core::SUM) {
+    return std::plus<Acc>();
+  } else if constexpr (Op == ppc::core::MIN) {
+    return boost::mpi::minimum<Acc>();
+  } else {
+    return boost::mpi::maximum<Acc>();
+  }
+}
+
+// Combines the results of ppc::core::reduce_matrix over the row blocks of
+// all ranks (block r holds rows that come after those of block r - 1, as
+// scatter_rows gives them) into `result` on the ranks chosen by
+// taskData.output_placement: BY_ROW results are gathered in rank order,
+// BY_COLUMN ones reduced element-wise and the TOTAL one reduced.
+template <ppc::core::Reduction Op, class Acc, class Comm>
+void combine_partials(const Comm& comm, const ppc::core::TaskData& taskData, ppc::core::ReductionAxis axis,
+                      const std::vector<Acc>& partial, std::vector<Acc>& result, int root = 0) {
+  switch (axis) {
+    case ppc::core::BY_ROW:
+      gather_result(comm, taskData, std::span<const Acc>(partial), result, root);
+      break;
+    case ppc::core::BY_COLUMN:
+      reduce_result(comm, taskData, partial.data(), static_cast<int>(partial.size()), result,
+                    reduction_op<Op, Acc>(), root);
+      break;
+    default:
+      result.resize(1);
+      reduce_result(comm, taskData, partial[0], result[0], reduction_op<Op, Acc>(), root);
+  }
+}
+
+// Op of the `matrix` of the root along `axis`, from the scatter of its
+// rows to the result on the ranks chosen by taskData.output_placement.
+template <ppc::core::Reduction Op, class Acc, class Comm, class T>
+void reduce_matrix(const Comm& comm, const ppc::core::TaskData& taskData, const ppc::core::Matrix<T>& matrix,
+                   ppc::core::ReductionAxis axis, std::vector<Acc>& result, int root = 0) {
+  std::vector<T> storage;
+  auto local = scatter_rows(comm, matrix, storage, root);
+  std::vector<Acc> partial;
+  ppc::core::reduce_matrix<Op>(local, axis, partial);
+  combine_partials<Op>(comm, taskData, axis, partial, result, root);
+}
+
+// MINLOC / MAXLOC of extrema whose positions are global, with a 64-bit
+// position and the first one among equal values
+template <ppc::core::Reduction Op, class T>
+struct ExtremumOp {
+  ppc::core::Extremum<T> operator()(const ppc::core::Extremum<T>& a, const ppc::core::Extremum<T>& b) const {
+    return ppc::core::combine_extrema<Op>(a, b);
+  }
+};
+
+// The extremum of the `local` ones of all ranks, whose positions are
+// global, on the ranks chosen by taskData.output_placement.
+template <ppc::core::Reduction Op, class Comm, class T>
+ppc::core::Extremum<T> combine_extrema(const Comm& comm, const ppc::core::TaskData& taskData,
+                                       const ppc::core::Extremum<T>& local, int root = 0) {
+  ppc::core::Extremum<T> result{};
+  reduce_result(comm, taskData, local, result, ExtremumOp<Op, T>(), root);
+  return result;
+}
+
+// MIN or MAX of the `matrix` of the root with its row-major position on the
+// ranks chosen by taskData.output_placement. Every rank finds the extremum
+// of its block of rows with the position offset by the elements of the
+// blocks before it, a single reduction then picks the global one.
+template <ppc::core::Reduction Op, class Comm, class T>
+ppc::core::Extremum<std::remove_const_t<T>> arg_reduce_matrix(const Comm& comm, const ppc::core::TaskData& taskData,
+                                                              const ppc::core::Matrix<T>& matrix, int root = 0) {
+  using Value = std::remove_const_t<T>;
+  std::vector<Value> storage;
+  auto local = scatter_rows(comm, matrix, storage, root);
+  std::uint64_t offset = block_offset(comm, local.rows()) * local.cols();
+  return combine_extrema<Op>(comm, taskData, ppc::core::arg_reduce_matrix<Op>(local, offset), root);
+}
+
+}  // namespace ppc::mpi
+
+namespace boost::mpi {
+template <ppc::core::Reduction Op, class T>
+struct is_commutative<ppc::mpi::ExtremumOp<Op, T>, ppc::core::Extremum<T>> : mpl::true_ {};
+}  // namespace boost::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_MATRIX_REDUCTION_HPP_
@@ -0,0 +1,121 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/operations.hpp>
+#include <climits>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "mpi_core/nonblocking/include/nonblocking.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/segmented_reduce/include/segmented_reduce.hpp"
+
+TEST(nonblocking_tests, check_ireduce_sum_on_root) {
+  boost::mpi::communicator world;
+  std::vector<int> values = {world.rank(), 1, 2 * world.rank()};
+
+  auto pending = ppc::mpi::ireduce(world, values.data(), 3, std::plus<int>(), 0);
+  // the input is copied, so the buffer can be reused right away
+  values.assign(3, -1);
+  auto result = pending.wait();
+
+  if (world.rank() == 0) {
+    int ranks_sum = world.size() * (world.size() - 1) / 2;
+    ASSERT_EQ(result.size(), 3U);
+    EXPECT_EQ(result[0], ranks_sum);
+    EXPECT_EQ(result[1], world.size());
+    EXPECT_EQ(result[2], 2 * ranks_sum);
+  } else {
+    EXPECT_TRUE(result.empty());
+  }
+}
+
+TEST(nonblocking_tests, check_iall_reduce_max_on_all_ranks) {
+  boost::mpi::communicator world;
+  auto pending = ppc::mpi::iall_reduce(world, world.rank() * 3, boost::mpi::maximum<int>());
+  auto result = pending.wait();
+  ASSERT_EQ(result.size(), 1U);
+  EXPECT_EQ(result[0], (world.size() - 1) * 3);
+}
+
+TEST(nonblocking_tests, check_pipelined_reductions) {
+  boost::mpi::communicator world;
+  const int n = 8;
+  std::vector<ppc::mpi::PendingReduction<int>> pending;
+  for (int i = 0; i < n; i++) {
+    pending.push_back(ppc::mpi::iall_reduce(world, world.rank() + i, std::plus<int>()));
+  }
+  // completed in the reverse order of the start
+  for (int i = n - 1; i >= 0; i--) {
+    EXPECT_EQ(pending[i].wait()[0], world.size() * (world.size() - 1) / 2 + world.size() * i);
+  }
+}
+
+TEST(nonblocking_tests, check_test_completes) {
+  boost::mpi::communicator world;
+  auto pending = ppc::mpi::iall_reduce(world, 1, std::plus<int>());
+  while (!pending.test()) {
+  }
+  EXPECT_TRUE(pending.test());
+  EXPECT_EQ(pending.wait()[0], world.size());
+}
+
+TEST(nonblocking_tests, check_moved_reduction) {
+  boost::mpi::communicator world;
+  ppc::mpi::PendingReduction<int> pending;
+  EXPECT_TRUE(pending.test());
+  pending = ppc::mpi::iall_reduce(world, 2, std::plus<int>());
+  ppc::mpi::PendingReduction<int> moved(std::move(pending));
+  EXPECT_EQ(moved.wait()[0], 2 * world.size());
+}
+
+TEST(nonblocking_tests, check_overlap_stats_count_calls) {
+  boost::mpi::communicator world;
+  auto before = ppc::mpi::OverlapStats::instance();
+  {
+    auto first = ppc::mpi::iall_reduce(world, 1, std::plus<int>());
+    auto second = ppc::mpi::ireduce(world, 1, std::plus<int>(), 0);
+    first.wait();
+    // the second one is completed by the destructor
+  }
+  const auto& after = ppc::mpi::OverlapStats::instance();
+  EXPECT_EQ(after.calls - before.calls, 2);
+  EXPECT_GE(after.window_sec, before.window_sec);
+  EXPECT_GE(after.exposed_sec, before.exposed_sec);
+}
+
+TEST(nonblocking_tests, check_segmented_reduction_in_batches) {
+  boost::mpi::communicator world;
+  const int rows = 11;
+  const int cols = 3;
+  std::vector<int> matrix(rows * cols);
+  for (int i = 0; i < rows * cols; i++) {
+    matrix[i] = (i * 37) % 23;
+  }
+
+  ppc::mpi::BlockPartition partition(rows * cols, world.size());
+  std::span<const int> block(matrix.data() + partition.offset(world.rank()), partition.count(world.rank()));
+  ppc::mpi::SegmentedReduction<int, boost::mpi::minimum<int>> rows_min(rows, INT_MAX);
+  ppc::mpi::BlockPartition batches(rows, 3);
+  std::vector<ppc::mpi::PendingReduction<int>> pending;
+  for (int b = 0; b < 3; b++) {
+    rows_min.add_rows(partition.offset(world.rank()), block, cols, batches.offset(b),
+                      batches.offset(b) + batches.count(b));
+    pending.push_back(rows_min.ireduce(world, batches.offset(b), batches.count(b), 0));
+  }
+
+  for (int b = 0; b < 3; b++) {
+    auto result = pending[b].wait();
+    if (world.rank() == 0) {
+      ASSERT_EQ(static_cast<int>(result.size()), batches.count(b));
+      for (int r = 0; r < batches.count(b); r++) {
+        int row = batches.offset(b) + r;
+        EXPECT_EQ(result[r], *std::min_element(matrix.begin() + row * cols, matrix.begin() + (row + 1) * cols));
+      }
+    }
+  }
+}
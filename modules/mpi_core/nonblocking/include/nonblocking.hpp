@@ -0,0 +1,126 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_NONBLOCKING_HPP_
+#define MODULES_MPI_CORE_INCLUDE_NONBLOCKING_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/operations.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace ppc::mpi {
+
+// Time of all split-phase collectives of the current rank. Every Perf
+// measurement gets its share as counters:
+// nonblocking.calls, nonblocking.window_sec (from the start until the rank
+// asked for the result, the window other work ran in while the transfer was
+// pending, so at most this much communication was hidden) and
+// nonblocking.exposed_sec (time blocked waiting for it).
+struct OverlapStats {
+  std::int64_t calls = 0;
+  double window_sec = 0.0;
+  double exposed_sec = 0.0;
+
+  static OverlapStats& instance();
+  void record(double window, double exposed);
+};
+
+// Reduction started with ireduce/iall_reduce and completed later with
+// test() or wait(). The input is copied on start, so the caller may reuse
+// its buffer right away. Must be completed on every rank of the
+// communicator, the destructor waits for it if nobody did.
+template <class T>
+class PendingReduction {
+ public:
+  PendingReduction() = default;
+  // start(in, out, request) starts the collective on the owned buffers
+  template <class Start>
+  PendingReduction(std::vector<T> in, std::size_t out_size, Start&& start)
+      : in_(std::move(in)), out_(out_size), start_(MPI_Wtime()) {
+    start(in_.data(), out_.data(), &request_);
+  }
+  PendingReduction(PendingReduction&& other) noexcept { *this = std::move(other); }
+  PendingReduction& operator=(PendingReduction&& other) noexcept {
+    if (this != &other) {
+      wait();
+      in_ = std::move(other.in_);
+      out_ = std::move(other.out_);
+      request_ = std::exchange(other.request_, MPI_REQUEST_NULL);
+      start_ = other.start_;
+    }
+    return *this;
+  }
+  ~PendingReduction() { wait(); }
+
+  // true when the reduction is complete, does not block
+  bool test() {
+    if (request_ == MPI_REQUEST_NULL) {
+      return true;
+    }
+    double asked = MPI_Wtime();
+    int done = 0;
+    MPI_Test(&request_, &done, MPI_STATUS_IGNORE);
+    if (done != 0) {
+      OverlapStats::instance().record(asked - start_, 0.0);
+    }
+    return done != 0;
+  }
+
+  // result, significant only on the root for ireduce
+  std::span<const T> wait() {
+    if (request_ != MPI_REQUEST_NULL) {
+      double asked = MPI_Wtime();
+      MPI_Wait(&request_, MPI_STATUS_IGNORE);
+      OverlapStats::instance().record(asked - start_, MPI_Wtime() - asked);
+    }
+    return out_;
+  }
+
+ private:
+  std::vector<T> in_;
+  std::vector<T> out_;
+  MPI_Request request_ = MPI_REQUEST_NULL;
+  double start_{};
+};
+
+// start reducing n values of every rank to the root
+template <class T, class Op>
+PendingReduction<T> ireduce(const boost::mpi::communicator& comm, const T* in_values, int n, Op /*op*/, int root) {
+  static_assert(boost::mpi::is_mpi_op<Op, T>::value, "split-phase reductions need an operation with an MPI_Op");
+  return PendingReduction<T>(std::vector<T>(in_values, in_values + n), comm.rank() == root ? n : 0,
+                             [&](const T* in, T* out, MPI_Request* request) {
+                               MPI_Ireduce(in, out, n, boost::mpi::get_mpi_datatype<T>(),
+                                           boost::mpi::is_mpi_op<Op, T>::op(), root, comm, request);
+                             });
+}
+
+template <class T, class Op>
+PendingReduction<T> ireduce(const boost::mpi::communicator& comm, const T& in_value, Op op, int root) {
+  return ireduce(comm, &in_value, 1, op, root);
+}
+
+// start reducing n values of every rank to all ranks
+template <class T, class Op>
+PendingReduction<T> iall_reduce(const boost::mpi::communicator& comm, const T* in_values, int n, Op /*op*/) {
+  static_assert(boost::mpi::is_mpi_op<Op, T>::value, "split-phase reductions need an operation with an MPI_Op");
+  return PendingReduction<T>(std::vector<T>(in_values, in_values + n), n,
+                             [&](const T* in, T* out, MPI_Request* request) {
+                               MPI_Iallreduce(in, out, n, boost::mpi::get_mpi_datatype<T>(),
+                                              boost::mpi::is_mpi_op<Op, T>::op(), comm, request);
+                             });
+}
+
+template <class T, class Op>
+PendingReduction<T> iall_reduce(const boost::mpi::communicator& comm, const T& in_value, Op op) {
+  return iall_reduce(comm, &in_value, 1, op);
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_NONBLOCKING_HPP_
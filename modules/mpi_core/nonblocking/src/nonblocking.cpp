@@ -0,0 +1,38 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi_core/nonblocking/include/nonblocking.hpp"
+
+#include "core/perf/include/perf.hpp"
+
+namespace {
+
+void add_counters(const ppc::mpi::OverlapStats& begin, ppc::core::PerfResults& perfResults) {
+  const auto& now = ppc::mpi::OverlapStats::instance();
+  if (now.calls == begin.calls) {
+    return;
+  }
+  perfResults.counters["nonblocking.calls"] = static_cast<double>(now.calls - begin.calls);
+  perfResults.counters["nonblocking.window_sec"] = now.window_sec - begin.window_sec;
+  perfResults.counters["nonblocking.exposed_sec"] = now.exposed_sec - begin.exposed_sec;
+}
+
+// every Perf measurement gets the split-phase collectives of its runs
+struct PerfHooks {
+  PerfHooks() {
+    ppc::core::Perf::add_hooks([this] { begin = ppc::mpi::OverlapStats::instance(); },
+                               [this](ppc::core::PerfResults& perfResults) { add_counters(begin, perfResults); });
+  }
+  ppc::mpi::OverlapStats begin;
+} perf_hooks;
+
+}  // namespace
+
+ppc::mpi::OverlapStats& ppc::mpi::OverlapStats::instance() {
+  static OverlapStats stats;
+  return stats;
+}
+
+void ppc::mpi::OverlapStats::record(double window, double exposed) {
+  calls++;
+  window_sec += window;
+  exposed_sec += exposed;
+}
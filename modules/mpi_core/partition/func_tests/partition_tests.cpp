@@ -0,0 +1,41 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "mpi_core/partition/include/partition.hpp"
+
+TEST(partition_tests, check_even_split) {
+  ppc::mpi::BlockPartition partition(12, 4);
+  EXPECT_EQ(partition.counts, std::vector<int>({3, 3, 3, 3}));
+  EXPECT_EQ(partition.displs, std::vector<int>({0, 3, 6, 9}));
+}
+
+TEST(partition_tests, check_remainder_goes_first) {
+  ppc::mpi::BlockPartition partition(10, 4);
+  EXPECT_EQ(partition.counts, std::vector<int>({3, 3, 2, 2}));
+  EXPECT_EQ(partition.displs, std::vector<int>({0, 3, 6, 8}));
+}
+
+TEST(partition_tests, check_more_parts_than_elements) {
+  ppc::mpi::BlockPartition partition(2, 4);
+  EXPECT_EQ(partition.counts, std::vector<int>({1, 1, 0, 0}));
+  EXPECT_EQ(partition.offset(3), 2);
+}
+
+TEST(partition_tests, check_large_split_beyond_int) {
+  const std::uint64_t total = (std::uint64_t{1} << 33) + 3;
+  ppc::mpi::LargeBlockPartition partition(total, 4);
+  EXPECT_EQ(partition.counts,
+            std::vector<std::uint64_t>({(total / 4) + 1, (total / 4) + 1, (total / 4) + 1, total / 4}));
+  EXPECT_EQ(partition.offset(3), 3 * ((total / 4) + 1));
+  EXPECT_EQ(partition.total(), total);
+}
+
+TEST(partition_tests, check_row_blocks_keep_rows_whole) {
+  auto partition = ppc::mpi::row_block_partition(10, 3, 4);
+  EXPECT_EQ(partition.counts, std::vector<std::uint64_t>({9, 9, 6, 6}));
+  EXPECT_EQ(partition.displs, std::vector<std::uint64_t>({0, 9, 18, 24}));
+  EXPECT_EQ(partition.total(), 30U);
+}
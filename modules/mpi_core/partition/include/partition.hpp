@@ -0,0 +1,51 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_PARTITION_HPP_
+#define MODULES_MPI_CORE_INCLUDE_PARTITION_HPP_
+
+#include <cstdint>
+#include <vector>
+
+namespace ppc::mpi {
+
+// Split of `total` elements into `parts` contiguous blocks, the first
+// total % parts blocks are one element longer than the others.
+template <class Count>
+struct BasicBlockPartition {
+  BasicBlockPartition(Count total, int parts) : counts(parts), displs(parts) {
+    Count offset = 0;
+    for (int part = 0; part < parts; part++) {
+      counts[part] = total / parts + (static_cast<Count>(part) < total % parts ? 1 : 0);
+      displs[part] = offset;
+      offset += counts[part];
+    }
+  }
+
+  [[nodiscard]] Count count(int part) const { return counts[part]; }
+  [[nodiscard]] Count offset(int part) const { return displs[part]; }
+  [[nodiscard]] Count total() const { return counts.empty() ? 0 : displs.back() + counts.back(); }
+
+  std::vector<Count> counts;
+  std::vector<Count> displs;
+};
+
+// counts and displacements can be passed to MPI collectives as is
+using BlockPartition = BasicBlockPartition<int>;
+// for inputs beyond int, transferred with the large-count helpers
+using LargeBlockPartition = BasicBlockPartition<std::uint64_t>;
+
+// Split of a matrix of `rows` rows of `row_length` elements into blocks of
+// whole rows, counted in elements: block r holds the rows of block r of
+// LargeBlockPartition(rows, parts).
+inline LargeBlockPartition row_block_partition(std::uint64_t rows, std::uint64_t row_length, int parts) {
+  LargeBlockPartition partition(rows, parts);
+  for (int part = 0; part < parts; part++) {
+    partition.counts[part] *= row_length;
+    partition.displs[part] *= row_length;
+  }
+  return partition;
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_PARTITION_HPP_
@@ -0,0 +1,86 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/persistent/func_tests/test_task.hpp"
+#include "mpi_core/persistent/include/persistent_scatter.hpp"
+
+TEST(persistent_tests, check_scatter_restarts) {
+  boost::mpi::communicator world;
+  std::vector<int> in(103);
+  std::iota(in.begin(), in.end(), 0);
+  ppc::mpi::BlockPartition partition(static_cast<int>(in.size()), world.size());
+
+  ppc::mpi::PersistentScatter<int> scatter(world, world.rank() == 0 ? in.data() : nullptr, partition);
+  for (int iteration = 0; iteration < 3; iteration++) {
+    if (world.rank() == 0) {
+      for (auto &value : in) {
+        value++;
+      }
+    }
+    scatter.start();
+    scatter.wait();
+    auto local = scatter.local();
+    ASSERT_EQ(static_cast<int>(local.size()), partition.count(world.rank()));
+    for (size_t i = 0; i < local.size(); i++) {
+      ASSERT_EQ(local[i], partition.offset(world.rank()) + static_cast<int>(i) + iteration + 1);
+    }
+  }
+}
+
+TEST(persistent_tests, check_plan_rebuilt_in_func_mode) {
+  boost::mpi::communicator world;
+  std::vector<int> in(50, 1);
+  std::vector<int> out(1, 0);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+  }
+
+  ppc::test::PersistentSumTask task(taskData);
+  for (int i = 0; i < 2; i++) {
+    ASSERT_TRUE(task.validation());
+    task.pre_processing();
+    task.run();
+    task.post_processing();
+  }
+  EXPECT_EQ(task.plan_builds(), 2);
+  if (world.rank() == 0) {
+    EXPECT_EQ(out[0], 50);
+  }
+}
+
+TEST(persistent_tests, check_plan_reused_by_perf) {
+  boost::mpi::communicator world;
+  std::vector<int> in(1000, 2);
+  std::vector<int> out(1, 0);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+  }
+
+  auto task = std::make_shared<ppc::test::PersistentSumTask>(taskData);
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  ppc::core::Perf perfAnalyzer(task);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+
+  EXPECT_EQ(task->plan_builds(), 1);
+  if (world.rank() == 0) {
+    EXPECT_EQ(out[0], 2000);
+  }
+}
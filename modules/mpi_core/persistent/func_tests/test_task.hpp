@@ -0,0 +1,69 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_TESTS_TEST_TASK_HPP_
+#define MODULES_MPI_CORE_TESTS_TEST_TASK_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+#include "core/task/include/task.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/persistent/include/persistent_scatter.hpp"
+#include "mpi_core/persistent/include/plan_cache.hpp"
+
+namespace ppc::test {
+
+// sum of a root vector scattered with a cached persistent plan
+class PersistentSumTask : public ppc::core::Task {
+ public:
+  explicit PersistentSumTask(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override {
+    internal_order_test();
+    auto& scatter = plan_.get(taskData, world, [&] {
+      int count = world.rank() == 0 ? static_cast<int>(taskData->inputs_count[0]) : 0;
+      const int *data = world.rank() == 0 ? reinterpret_cast<int *>(taskData->inputs[0]) : nullptr;
+      boost::mpi::broadcast(world, count, 0);
+      return std::make_unique<ppc::mpi::PersistentScatter<int>>(world, data,
+                                                                ppc::mpi::BlockPartition(count, world.size()));
+    });
+    scatter.start();
+    scatter.wait();
+    local_sum_ = std::accumulate(scatter.local().begin(), scatter.local().end(), 0);
+    return true;
+  }
+
+  bool validation() override {
+    internal_order_test();
+    return world.rank() != 0 || taskData->outputs_count[0] == 1;
+  }
+
+  bool run() override {
+    internal_order_test();
+    boost::mpi::reduce(world, local_sum_, sum_, std::plus(), 0);
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    if (world.rank() == 0) {
+      reinterpret_cast<int *>(taskData->outputs[0])[0] = sum_;
+    }
+    return true;
+  }
+
+  [[nodiscard]] int plan_builds() const { return plan_.builds(); }
+
+ private:
+  boost::mpi::communicator world;
+  ppc::mpi::PlanCache<ppc::mpi::PersistentScatter<int>> plan_;
+  int local_sum_{};
+  int sum_{};
+};
+
+}  // namespace ppc::test
+
+#endif  // MODULES_MPI_CORE_TESTS_TEST_TASK_HPP_
@@ -0,0 +1,86 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_PERSISTENT_SCATTER_HPP_
+#define MODULES_MPI_CORE_INCLUDE_PERSISTENT_SCATTER_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <span>
+#include <vector>
+
+#include "mpi_core/partition/include/partition.hpp"
+
+namespace ppc::mpi {
+
+// Scatter of blocks from a fixed root buffer set up once with persistent
+// requests, every start() only restarts the already matched transfers.
+// The root keeps its own block in place in `data`, other ranks receive
+// into a buffer owned by the plan. Construction is collective.
+template <class T>
+class PersistentScatter {
+ public:
+  // `data` is significant only on the root and must stay alive and at the
+  // same address while the plan is used
+  PersistentScatter(const boost::mpi::communicator& world, const T* data, const BlockPartition& partition,
+                    int root = 0)
+      : world_(world), partition_(partition) {
+    MPI_Datatype type = boost::mpi::get_mpi_datatype<T>();
+    int rank = world.rank();
+    if (rank == root) {
+      local_ = std::span<const T>(data + partition.offset(rank), partition.count(rank));
+    } else {
+      buffer_.resize(partition.count(rank));
+      local_ = std::span<const T>(buffer_);
+    }
+#if MPI_VERSION >= 4
+    requests_.resize(1);
+    const void* send = rank == root ? data : nullptr;
+    void* recv = rank == root ? MPI_IN_PLACE : buffer_.data();
+    MPI_Scatterv_init(send, partition.counts.data(), partition.displs.data(), type, recv, partition.count(rank), type,
+                      root, world, MPI_INFO_NULL, requests_.data());
+#else
+    if (rank == root) {
+      for (int proc = 0; proc < world.size(); proc++) {
+        if (proc != root) {
+          requests_.emplace_back();
+          MPI_Send_init(data + partition.offset(proc), partition.count(proc), type, proc, 0, world,
+                        &requests_.back());
+        }
+      }
+    } else {
+      requests_.emplace_back();
+      MPI_Recv_init(buffer_.data(), partition.count(rank), type, root, 0, world, &requests_.back());
+    }
+#endif
+  }
+
+  PersistentScatter(const PersistentScatter&) = delete;
+  PersistentScatter& operator=(const PersistentScatter&) = delete;
+
+  ~PersistentScatter() {
+    for (auto& request : requests_) {
+      MPI_Request_free(&request);
+    }
+  }
+
+  void start() { MPI_Startall(static_cast<int>(requests_.size()), requests_.data()); }
+  void wait() { MPI_Waitall(static_cast<int>(requests_.size()), requests_.data(), MPI_STATUSES_IGNORE); }
+
+  // block of the current rank, valid after wait()
+  [[nodiscard]] std::span<const T> local() const { return local_; }
+  [[nodiscard]] const BlockPartition& partition() const { return partition_; }
+  [[nodiscard]] const boost::mpi::communicator& comm() const { return world_; }
+
+ private:
+  boost::mpi::communicator world_;
+  BlockPartition partition_;
+  std::vector<T> buffer_;
+  std::span<const T> local_;
+  std::vector<MPI_Request> requests_;
+};
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_PERSISTENT_SCATTER_HPP_
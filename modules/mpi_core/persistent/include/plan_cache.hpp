@@ -0,0 +1,64 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_PLAN_CACHE_HPP_
+#define MODULES_MPI_CORE_INCLUDE_PLAN_CACHE_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <memory>
+#include <utility>
+
+#include "core/task/include/task.hpp"
+
+namespace ppc::mpi {
+
+// Communication plan of a task kept between its runs. A task owns the cache,
+// so the plan is keyed by the task, its TaskData and the communicator.
+// Perf runs the same task on the same unchanged data on every rank, so while
+// the data is under performance testing the plan is reused without any
+// communication: no setup and no exchange of sizes. In all other cases the
+// plan is rebuilt on every run, because only the root sees the sizes and
+// they may change between runs.
+template <class Plan>
+class PlanCache {
+ public:
+  // `make` is collective and returns std::unique_ptr<Plan>
+  template <class Factory>
+  Plan& get(const std::shared_ptr<ppc::core::TaskData>& taskData, const boost::mpi::communicator& comm,
+            Factory&& make) {
+    if (!reusable(taskData, comm)) {
+      plan_.reset();
+      plan_ = std::forward<Factory>(make)();
+      taskData_ = taskData.get();
+      comm_ = comm;
+      ++builds_;
+    }
+    return *plan_;
+  }
+
+  void reset() { plan_.reset(); }
+
+  // number of times the plan was built
+  [[nodiscard]] int builds() const { return builds_; }
+
+ private:
+  bool reusable(const std::shared_ptr<ppc::core::TaskData>& taskData, const boost::mpi::communicator& comm) const {
+    if (!plan_ || taskData.get() != taskData_ ||
+        taskData->state_of_testing != ppc::core::TaskData::StateOfTesting::PERF) {
+      return false;
+    }
+    int result;
+    MPI_Comm_compare(comm, comm_, &result);
+    return result == MPI_IDENT;
+  }
+
+  std::unique_ptr<Plan> plan_;
+  const ppc::core::TaskData* taskData_{};
+  boost::mpi::communicator comm_;
+  int builds_{};
+};
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_PLAN_CACHE_HPP_
@@ -0,0 +1,58 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+#include "mpi_core/persistent/func_tests/test_task.hpp"
+#include "mpi_core/profiler/include/profiler.hpp"
+
+TEST(profiler_tests, check_counters_since_snapshot) {
+  ppc::mpi::Profiler profiler;
+  profiler.record("MPI_Send", 8, 0.5);
+  auto since = profiler.stats();
+  profiler.record("MPI_Send", 16, 0.25);
+  profiler.record("MPI_Bcast", 4, 0.125);
+
+  // calls outside of tasks belong to the phase entered last
+  std::string phase = ppc::core::Task::current_phase().empty() ? "none" : ppc::core::Task::current_phase();
+  auto counters = ppc::mpi::Profiler::counters(profiler.stats(), since);
+  EXPECT_EQ(counters.size(), 6U);
+  EXPECT_EQ(counters["MPI_Send." + phase + ".calls"], 1.0);
+  EXPECT_EQ(counters["MPI_Send." + phase + ".bytes"], 16.0);
+  EXPECT_EQ(counters["MPI_Send." + phase + ".time_sec"], 0.25);
+  EXPECT_EQ(counters["MPI_Bcast." + phase + ".calls"], 1.0);
+}
+
+TEST(profiler_tests, check_perf_gets_calls_by_phase) {
+  if (!ppc::mpi::Profiler::enabled()) {
+    GTEST_SKIP() << "built without USE_MPI_PROFILER";
+  }
+  boost::mpi::communicator world;
+  std::vector<int> in(100, 1);
+  std::vector<int> out(1, 0);
+  auto taskData = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskData->inputs_count.emplace_back(in.size());
+    taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+    taskData->outputs_count.emplace_back(out.size());
+  }
+
+  auto task = std::make_shared<ppc::test::PersistentSumTask>(taskData);
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 3;
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+  ppc::core::Perf perfAnalyzer(task);
+  perfAnalyzer.pipeline_run(perfAttr, perfResults);
+
+  // the plan is built once in pre_processing, the sum is reduced in every run
+  EXPECT_EQ(perfResults->counters["MPI_Bcast.pre_processing.calls"], 1.0);
+  EXPECT_EQ(perfResults->counters["MPI_Reduce.run.calls"], 3.0);
+  EXPECT_EQ(perfResults->counters["MPI_Reduce.run.bytes"], 3.0 * sizeof(int));
+}
@@ -0,0 +1,57 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_PROFILER_HPP_
+#define MODULES_MPI_CORE_INCLUDE_PROFILER_HPP_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace ppc::mpi {
+
+struct CallStats {
+  std::int64_t calls = 0;
+  // data passed through the calls by this rank: sent, received or reduced
+  std::int64_t bytes = 0;
+  // time spent inside the calls including waiting for other ranks
+  double time_sec = 0.0;
+};
+
+// Statistics of MPI calls of the current rank by routine and by the Task
+// phase (validation, pre_processing, run, post_processing) they were made
+// from. When the project is configured with USE_MPI_PROFILER the MPI
+// routines are intercepted through PMPI and recorded here, every Perf
+// measurement gets its share as PerfResults::counters and a summary over
+// all ranks is printed on MPI_Finalize.
+class Profiler {
+ public:
+  // (routine, phase)
+  using Key = std::pair<std::string, std::string>;
+  using Stats = std::map<Key, CallStats>;
+
+  static Profiler& instance();
+
+  static constexpr bool enabled() {
+#ifdef USE_MPI_PROFILER
+    return true;
+#else
+    return false;
+#endif
+  }
+
+  // add a call made from the current phase
+  void record(const char* routine, std::int64_t bytes, double time_sec);
+  void reset() { stats_.clear(); }
+  [[nodiscard]] const Stats& stats() const { return stats_; }
+
+  // statistics of `now` minus `since` as counters named <routine>.<phase>.<calls|bytes|time_sec>
+  static std::map<std::string, double> counters(const Stats& now, const Stats& since = {});
+
+ private:
+  Stats stats_;
+};
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_PROFILER_HPP_
@@ -0,0 +1,328 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi_core/profiler/include/profiler.hpp"
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "core/perf/include/perf.hpp"
+#include "core/task/include/task.hpp"
+
+ppc::mpi::Profiler& ppc::mpi::Profiler::instance() {
+  static Profiler profiler;
+  return profiler;
+}
+
+void ppc::mpi::Profiler::record(const char* routine, std::int64_t bytes, double time_sec) {
+  const auto& phase = ppc::core::Task::current_phase();
+  auto& stats = stats_[Key(routine, phase.empty() ? "none" : phase)];
+  stats.calls++;
+  stats.bytes += bytes;
+  stats.time_sec += time_sec;
+}
+
+std::map<std::string, double> ppc::mpi::Profiler::counters(const Stats& now, const Stats& since) {
+  std::map<std::string, double> result;
+  for (const auto& [key, stats] : now) {
+    CallStats before;
+    if (auto it = since.find(key); it != since.end()) {
+      before = it->second;
+    }
+    if (stats.calls == before.calls) {
+      continue;
+    }
+    auto name = key.first + "." + key.second + ".";
+    result[name + "calls"] = static_cast<double>(stats.calls - before.calls);
+    result[name + "bytes"] = static_cast<double>(stats.bytes - before.bytes);
+    result[name + "time_sec"] = stats.time_sec - before.time_sec;
+  }
+  return result;
+}
+
+#ifdef USE_MPI_PROFILER
+
+namespace {
+
+using ppc::mpi::Profiler;
+
+std::int64_t bytes_of(int count, MPI_Datatype type) {
+  if (count <= 0 || type == MPI_DATATYPE_NULL) {
+    return 0;
+  }
+  int size = 0;
+  PMPI_Type_size(type, &size);
+  return static_cast<std::int64_t>(count) * size;
+}
+
+std::int64_t bytes_of(const int* counts, MPI_Datatype type, MPI_Comm comm) {
+  int size = 0;
+  PMPI_Comm_size(comm, &size);
+  std::int64_t total = 0;
+  for (int i = 0; i < size; i++) {
+    total += bytes_of(counts[i], type);
+  }
+  return total;
+}
+
+bool is_root(int root, MPI_Comm comm) {
+  int rank = 0;
+  PMPI_Comm_rank(comm, &rank);
+  return rank == root;
+}
+
+// records the call when leaving the wrapper
+class Timed {
+ public:
+  Timed(const char* routine, std::int64_t bytes) : routine_(routine), bytes_(bytes), start_(PMPI_Wtime()) {}
+  Timed(const Timed&) = delete;
+  Timed& operator=(const Timed&) = delete;
+  ~Timed() { Profiler::instance().record(routine_, bytes_, PMPI_Wtime() - start_); }
+
+ private:
+  const char* routine_;
+  std::int64_t bytes_;
+  double start_;
+};
+
+// every Perf measurement gets the calls made during its runs
+struct PerfHooks {
+  PerfHooks() {
+    ppc::core::Perf::add_hooks([this] { begin = Profiler::instance().stats(); },
+                               [this](ppc::core::PerfResults& perfResults) {
+                                 auto counters = Profiler::counters(Profiler::instance().stats(), begin);
+                                 perfResults.counters.insert(counters.begin(), counters.end());
+                               });
+  }
+  Profiler::Stats begin;
+} perf_hooks;
+
+// summary over all ranks on the root of MPI_COMM_WORLD
+void print_summary() {
+  int rank = 0;
+  int size = 0;
+  PMPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  PMPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  std::ostringstream local;
+  for (const auto& [key, stats] : Profiler::instance().stats()) {
+    local << key.first << ' ' << key.second << ' ' << stats.calls << ' ' << stats.bytes << ' ' << stats.time_sec
+          << '\n';
+  }
+  auto text = local.str();
+  int length = static_cast<int>(text.size());
+  std::vector<int> lengths(size);
+  PMPI_Gather(&length, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, MPI_COMM_WORLD);
+  std::vector<int> displs(size);
+  for (int i = 1; i < size; i++) {
+    displs[i] = displs[i - 1] + lengths[i - 1];
+  }
+  std::vector<char> all(rank == 0 ? displs.back() + lengths.back() : 0);
+  PMPI_Gatherv(text.data(), length, MPI_CHAR, all.data(), lengths.data(), displs.data(), MPI_CHAR, 0,
+               MPI_COMM_WORLD);
+  if (rank != 0) {
+    return;
+  }
+
+  struct Summary {
+    ppc::mpi::CallStats total;
+    double max_time_sec = 0.0;
+  };
+  std::map<Profiler::Key, Summary> summary;
+  std::istringstream lines(std::string(all.begin(), all.end()));
+  Profiler::Key key;
+  ppc::mpi::CallStats stats;
+  while (lines >> key.first >> key.second >> stats.calls >> stats.bytes >> stats.time_sec) {
+    auto& entry = summary[key];
+    entry.total.calls += stats.calls;
+    entry.total.bytes += stats.bytes;
+    entry.total.time_sec += stats.time_sec;
+    entry.max_time_sec = std::max(entry.max_time_sec, stats.time_sec);
+  }
+
+  std::cout << "MPI profile of " << size << " ranks (calls and bytes of all ranks, time_sec total / max of a rank)"
+            << std::endl;
+  for (const auto& [name, entry] : summary) {
+    std::cout << std::left << std::setw(20) << name.first << std::setw(16) << name.second << std::right
+              << std::setw(12) << entry.total.calls << std::setw(16) << entry.total.bytes << std::fixed
+              << std::setprecision(6) << std::setw(14) << entry.total.time_sec << std::setw(14) << entry.max_time_sec
+              << std::endl;
+  }
+}
+
+}  // namespace
+
+int MPI_Send(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm) {
+  Timed timed("MPI_Send", bytes_of(count, datatype));
+  return PMPI_Send(buf, count, datatype, dest, tag, comm);
+}
+
+int MPI_Recv(void* buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Status* status) {
+  Timed timed("MPI_Recv", bytes_of(count, datatype));
+  return PMPI_Recv(buf, count, datatype, source, tag, comm, status);
+}
+
+int MPI_Isend(const void* buf, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm,
+              MPI_Request* request) {
+  Timed timed("MPI_Isend", bytes_of(count, datatype));
+  return PMPI_Isend(buf, count, datatype, dest, tag, comm, request);
+}
+
+int MPI_Irecv(void* buf, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm,
+              MPI_Request* request) {
+  Timed timed("MPI_Irecv", bytes_of(count, datatype));
+  return PMPI_Irecv(buf, count, datatype, source, tag, comm, request);
+}
+
+int MPI_Sendrecv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, int dest, int sendtag, void* recvbuf,
+                 int recvcount, MPI_Datatype recvtype, int source, int recvtag, MPI_Comm comm, MPI_Status* status) {
+  Timed timed("MPI_Sendrecv", bytes_of(sendcount, sendtype) + bytes_of(recvcount, recvtype));
+  return PMPI_Sendrecv(sendbuf, sendcount, sendtype, dest, sendtag, recvbuf, recvcount, recvtype, source, recvtag,
+                       comm, status);
+}
+
+int MPI_Probe(int source, int tag, MPI_Comm comm, MPI_Status* status) {
+  Timed timed("MPI_Probe", 0);
+  return PMPI_Probe(source, tag, comm, status);
+}
+
+int MPI_Wait(MPI_Request* request, MPI_Status* status) {
+  Timed timed("MPI_Wait", 0);
+  return PMPI_Wait(request, status);
+}
+
+int MPI_Test(MPI_Request* request, int* flag, MPI_Status* status) {
+  Timed timed("MPI_Test", 0);
+  return PMPI_Test(request, flag, status);
+}
+
+int MPI_Waitall(int count, MPI_Request array_of_requests[], MPI_Status array_of_statuses[]) {
+  Timed timed("MPI_Waitall", 0);
+  return PMPI_Waitall(count, array_of_requests, array_of_statuses);
+}
+
+int MPI_Startall(int count, MPI_Request array_of_requests[]) {
+  Timed timed("MPI_Startall", 0);
+  return PMPI_Startall(count, array_of_requests);
+}
+
+int MPI_Barrier(MPI_Comm comm) {
+  Timed timed("MPI_Barrier", 0);
+  return PMPI_Barrier(comm);
+}
+
+int MPI_Bcast(void* buffer, int count, MPI_Datatype datatype, int root, MPI_Comm comm) {
+  Timed timed("MPI_Bcast", bytes_of(count, datatype));
+  return PMPI_Bcast(buffer, count, datatype, root, comm);
+}
+
+int MPI_Reduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root,
+               MPI_Comm comm) {
+  Timed timed("MPI_Reduce", bytes_of(count, datatype));
+  return PMPI_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm);
+}
+
+int MPI_Allreduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm) {
+  Timed timed("MPI_Allreduce", bytes_of(count, datatype));
+  return PMPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
+}
+
+int MPI_Ireduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, int root,
+                MPI_Comm comm, MPI_Request* request) {
+  Timed timed("MPI_Ireduce", bytes_of(count, datatype));
+  return PMPI_Ireduce(sendbuf, recvbuf, count, datatype, op, root, comm, request);
+}
+
+int MPI_Iallreduce(const void* sendbuf, void* recvbuf, int count, MPI_Datatype datatype, MPI_Op op, MPI_Comm comm,
+                   MPI_Request* request) {
+  Timed timed("MPI_Iallreduce", bytes_of(count, datatype));
+  return PMPI_Iallreduce(sendbuf, recvbuf, count, datatype, op, comm, request);
+}
+
+int MPI_Reduce_scatter(const void* sendbuf, void* recvbuf, const int recvcounts[], MPI_Datatype datatype, MPI_Op op,
+                       MPI_Comm comm) {
+  Timed timed("MPI_Reduce_scatter", bytes_of(recvcounts, datatype, comm));
+  return PMPI_Reduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm);
+}
+
+int MPI_Scatter(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  int size = 0;
+  PMPI_Comm_size(comm, &size);
+  Timed timed("MPI_Scatter",
+              is_root(root, comm) ? size * bytes_of(sendcount, sendtype) : bytes_of(recvcount, recvtype));
+  return PMPI_Scatter(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Scatterv(const void* sendbuf, const int sendcounts[], const int displs[], MPI_Datatype sendtype, void* recvbuf,
+                 int recvcount, MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  Timed timed("MPI_Scatterv",
+              is_root(root, comm) ? bytes_of(sendcounts, sendtype, comm) : bytes_of(recvcount, recvtype));
+  return PMPI_Scatterv(sendbuf, sendcounts, displs, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Gather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+               MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  int size = 0;
+  PMPI_Comm_size(comm, &size);
+  Timed timed("MPI_Gather",
+              is_root(root, comm) ? size * bytes_of(recvcount, recvtype) : bytes_of(sendcount, sendtype));
+  return PMPI_Gather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, root, comm);
+}
+
+int MPI_Gatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, const int recvcounts[],
+                const int displs[], MPI_Datatype recvtype, int root, MPI_Comm comm) {
+  Timed timed("MPI_Gatherv",
+              is_root(root, comm) ? bytes_of(recvcounts, recvtype, comm) : bytes_of(sendcount, sendtype));
+  return PMPI_Gatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, root, comm);
+}
+
+int MPI_Allgather(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                  MPI_Datatype recvtype, MPI_Comm comm) {
+  int size = 0;
+  PMPI_Comm_size(comm, &size);
+  Timed timed("MPI_Allgather", size * bytes_of(recvcount, recvtype));
+  return PMPI_Allgather(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
+}
+
+int MPI_Allgatherv(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, const int recvcounts[],
+                   const int displs[], MPI_Datatype recvtype, MPI_Comm comm) {
+  Timed timed("MPI_Allgatherv", bytes_of(recvcounts, recvtype, comm));
+  return PMPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm);
+}
+
+int MPI_Alltoall(const void* sendbuf, int sendcount, MPI_Datatype sendtype, void* recvbuf, int recvcount,
+                 MPI_Datatype recvtype, MPI_Comm comm) {
+  int size = 0;
+  PMPI_Comm_size(comm, &size);
+  Timed timed("MPI_Alltoall", size * bytes_of(sendcount, sendtype));
+  return PMPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
+}
+
+int MPI_Win_fence(int mpi_assert, MPI_Win win) {
+  Timed timed("MPI_Win_fence", 0);
+  return PMPI_Win_fence(mpi_assert, win);
+}
+
+int MPI_Get(void* origin_addr, int origin_count, MPI_Datatype origin_datatype, int target_rank, MPI_Aint target_disp,
+            int target_count, MPI_Datatype target_datatype, MPI_Win win) {
+  Timed timed("MPI_Get", bytes_of(origin_count, origin_datatype));
+  return PMPI_Get(origin_addr, origin_count, origin_datatype, target_rank, target_disp, target_count, target_datatype,
+                  win);
+}
+
+int MPI_Win_flush(int rank, MPI_Win win) {
+  Timed timed("MPI_Win_flush", 0);
+  return PMPI_Win_flush(rank, win);
+}
+
+int MPI_Finalize() {
+  print_summary();
+  return PMPI_Finalize();
+}
+
+#endif  // USE_MPI_PROFILER
@@ -0,0 +1,67 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+#include <mpi.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "mpi_core/nonblocking/include/nonblocking.hpp"
+#include "mpi_core/progress/include/progress.hpp"
+
+TEST(progress_tests, check_off_by_default) {
+  auto before = ppc::mpi::Progress::polls();
+  std::size_t blocks = 0;
+  ppc::mpi::for_each_block(100, 10, [&](std::size_t, std::size_t) { blocks++; });
+  EXPECT_EQ(blocks, 10U);
+  EXPECT_EQ(ppc::mpi::Progress::polls(), before);
+}
+
+TEST(progress_tests, check_polls_at_block_boundaries) {
+  std::vector<std::size_t> ends;
+  std::int64_t polls = 0;
+  {
+    ppc::mpi::Progress progress(ppc::mpi::Progress::POLL, 0.0);
+    EXPECT_EQ(progress.mode(), ppc::mpi::Progress::POLL);
+    auto before = ppc::mpi::Progress::polls();
+    ppc::mpi::for_each_block(25, 10, [&](std::size_t, std::size_t end) { ends.push_back(end); });
+    polls = ppc::mpi::Progress::polls() - before;
+  }
+  EXPECT_EQ(ends, std::vector<std::size_t>({10, 20, 25}));
+  EXPECT_EQ(polls, 3);
+
+  // the scope is over, polling is off again
+  auto before = ppc::mpi::Progress::polls();
+  ppc::mpi::poll_progress();
+  EXPECT_EQ(ppc::mpi::Progress::polls(), before);
+}
+
+TEST(progress_tests, check_thread_needs_thread_multiple) {
+  int provided = MPI_THREAD_SINGLE;
+  MPI_Query_thread(&provided);
+  ppc::mpi::Progress progress(ppc::mpi::Progress::THREAD);
+  EXPECT_EQ(progress.mode(),
+            provided == MPI_THREAD_MULTIPLE ? ppc::mpi::Progress::THREAD : ppc::mpi::Progress::POLL);
+}
+
+TEST(progress_tests, check_reduction_behind_polled_compute) {
+  boost::mpi::communicator world;
+  const int n = 1 << 18;
+  std::vector<int> values(n, world.rank() + 1);
+
+  ppc::mpi::Progress progress(ppc::mpi::Progress::POLL, 0.0);
+  auto pending = ppc::mpi::iall_reduce(world, values.data(), n, std::plus<int>());
+  std::int64_t checksum = 0;
+  ppc::mpi::for_each_block(values.size(), 4096, [&](std::size_t begin, std::size_t end) {
+    checksum = std::accumulate(values.begin() + begin, values.begin() + end, checksum);
+  });
+  auto result = pending.wait();
+
+  EXPECT_EQ(checksum, static_cast<std::int64_t>(n) * (world.rank() + 1));
+  ASSERT_EQ(result.size(), static_cast<std::size_t>(n));
+  EXPECT_EQ(result[0], world.size() * (world.size() + 1) / 2);
+  EXPECT_EQ(result[n - 1], world.size() * (world.size() + 1) / 2);
+}
@@ -0,0 +1,63 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_PROGRESS_HPP_
+#define MODULES_MPI_CORE_INCLUDE_PROGRESS_HPP_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace ppc::mpi {
+
+// Non-blocking operations only progress while the rank is inside MPI, so a
+// rank busy computing stalls its outstanding sends and split-phase
+// reductions until it finally waits for them. While a Progress scope is
+// alive MPI is entered periodically anyway:
+//   POLL   - poll_progress() at chunk boundaries of the iteration helpers
+//            (for_each_block, DynamicScheduler::for_each,
+//            SegmentedReduction::add_rows), at most once per interval;
+//   THREAD - a helper thread polls every interval, needs MPI initialized
+//            with MPI_THREAD_MULTIPLE and falls back to POLL otherwise.
+// Off by default; scopes nest, the innermost one is in effect.
+class Progress {
+ public:
+  enum Mode { OFF, POLL, THREAD };
+
+  explicit Progress(Mode mode, double interval_sec = 50e-6);
+  Progress(const Progress&) = delete;
+  Progress& operator=(const Progress&) = delete;
+  ~Progress();
+
+  // mode in effect after the fallback
+  [[nodiscard]] Mode mode() const { return mode_; }
+
+  // polls of the current rank so far
+  static std::int64_t polls();
+
+ private:
+  Mode mode_;
+  Mode previous_mode_;
+  double previous_interval_;
+  std::atomic<bool> stop_{false};
+  std::thread thread_;
+};
+
+// enters MPI if polling is on and the interval has passed, a flag check
+// otherwise
+void poll_progress();
+
+// calls body(begin, end) for consecutive blocks of [0, count), polling
+// between them
+template <class Body>
+void for_each_block(std::size_t count, std::size_t block, Body&& body) {
+  for (std::size_t begin = 0; begin < count; begin += block) {
+    body(begin, std::min(count, begin + block));
+    poll_progress();
+  }
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_PROGRESS_HPP_
@@ -0,0 +1,83 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi_core/progress/include/progress.hpp"
+
+#include <mpi.h>
+
+#include <chrono>
+
+#include "core/perf/include/perf.hpp"
+
+namespace {
+
+ppc::mpi::Progress::Mode current_mode = ppc::mpi::Progress::OFF;
+double current_interval = 0.0;
+double last_poll = 0.0;
+std::atomic<std::int64_t> polls_done{0};
+
+// any call that runs the progress engine will do; the probe goes around
+// the profiler, the polls are not communication of the task
+void poke() {
+  int flag = 0;
+  PMPI_Iprobe(MPI_ANY_SOURCE, MPI_ANY_TAG, MPI_COMM_WORLD, &flag, MPI_STATUS_IGNORE);
+  polls_done.fetch_add(1, std::memory_order_relaxed);
+}
+
+// every Perf measurement gets the polls of its runs as progress.polls
+struct PerfHooks {
+  PerfHooks() {
+    ppc::core::Perf::add_hooks([this] { begin = polls_done.load(); },
+                               [this](ppc::core::PerfResults& perfResults) {
+                                 std::int64_t polls = polls_done.load() - begin;
+                                 if (polls != 0) {
+                                   perfResults.counters["progress.polls"] = static_cast<double>(polls);
+                                 }
+                               });
+  }
+  std::int64_t begin = 0;
+} perf_hooks;
+
+}  // namespace
+
+ppc::mpi::Progress::Progress(Mode mode, double interval_sec)
+    : mode_(mode), previous_mode_(current_mode), previous_interval_(current_interval) {
+  if (mode_ == THREAD) {
+    int provided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&provided);
+    if (provided != MPI_THREAD_MULTIPLE) {
+      mode_ = POLL;
+    }
+  }
+  current_mode = mode_;
+  current_interval = interval_sec;
+  last_poll = MPI_Wtime();
+  if (mode_ == THREAD) {
+    thread_ = std::thread([this, interval_sec] {
+      while (!stop_.load(std::memory_order_relaxed)) {
+        poke();
+        std::this_thread::sleep_for(std::chrono::duration<double>(interval_sec));
+      }
+    });
+  }
+}
+
+ppc::mpi::Progress::~Progress() {
+  if (thread_.joinable()) {
+    stop_ = true;
+    thread_.join();
+  }
+  current_mode = previous_mode_;
+  current_interval = previous_interval_;
+}
+
+std::int64_t ppc::mpi::Progress::polls() { return polls_done.load(); }
+
+void ppc::mpi::poll_progress() {
+  if (current_mode != Progress::POLL) {
+    return;
+  }
+  double now = MPI_Wtime();
+  if (now - last_poll >= current_interval) {
+    last_poll = now;
+    poke();
+  }
+}
@@ -0,0 +1,147 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/operations.hpp>
+#include <functional>
+#include <span>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/result_placement/include/result_placement.hpp"
+
+namespace {
+
+ppc::core::TaskData placed(ppc::core::TaskData::OutputPlacement placement) {
+  ppc::core::TaskData taskData;
+  taskData.output_placement = placement;
+  return taskData;
+}
+
+}  // namespace
+
+TEST(result_placement_tests, check_value_on_root) {
+  boost::mpi::communicator world;
+  auto taskData = placed(ppc::core::TaskData::ROOT);
+  int result = -1;
+  ppc::mpi::reduce_result(world, taskData, world.rank() + 1, result, std::plus<int>());
+  EXPECT_EQ(ppc::mpi::holds_result(world, taskData), world.rank() == 0);
+  if (world.rank() == 0) {
+    EXPECT_EQ(result, world.size() * (world.size() + 1) / 2);
+  } else {
+    EXPECT_EQ(result, -1);
+  }
+}
+
+TEST(result_placement_tests, check_value_on_all_ranks) {
+  boost::mpi::communicator world;
+  auto taskData = placed(ppc::core::TaskData::ALL_RANKS);
+  int result = -1;
+  ppc::mpi::reduce_result(world, taskData, world.rank(), result, boost::mpi::maximum<int>());
+  EXPECT_TRUE(ppc::mpi::holds_result(world, taskData));
+  EXPECT_EQ(result, world.size() - 1);
+}
+
+TEST(result_placement_tests, check_array_placements) {
+  boost::mpi::communicator world;
+  const int n = 11;
+  std::vector<int> local(n);
+  for (int i = 0; i < n; i++) {
+    local[i] = i * (world.rank() + 1);
+  }
+  int factor = world.size() * (world.size() + 1) / 2;
+
+  for (auto placement :
+       {ppc::core::TaskData::ROOT, ppc::core::TaskData::ALL_RANKS, ppc::core::TaskData::DISTRIBUTED}) {
+    auto taskData = placed(placement);
+    std::vector<int> result;
+    ppc::mpi::reduce_result(world, taskData, local.data(), n, result, std::plus<int>());
+
+    int first = 0;
+    int count = n;
+    if (placement == ppc::core::TaskData::DISTRIBUTED) {
+      ppc::mpi::BlockPartition owners(n, world.size());
+      first = owners.offset(world.rank());
+      count = owners.count(world.rank());
+    } else if (placement == ppc::core::TaskData::ROOT && world.rank() != 0) {
+      count = 0;
+    }
+    ASSERT_EQ(static_cast<int>(result.size()), count);
+    for (int i = 0; i < count; i++) {
+      EXPECT_EQ(result[i], (first + i) * factor);
+    }
+  }
+}
+
+TEST(result_placement_tests, check_distributed_reduction_with_user_op) {
+  boost::mpi::communicator world;
+  auto taskData = placed(ppc::core::TaskData::DISTRIBUTED);
+  const int n = 7;
+  std::vector<int> local(n, world.rank() + 1);
+  std::vector<int> result;
+  // not an MPI op, goes through a reduction and a scatter
+  ppc::mpi::reduce_result(world, taskData, local.data(), n, result, [](int a, int b) { return a > b ? a : b; });
+
+  ASSERT_EQ(static_cast<int>(result.size()), ppc::mpi::BlockPartition(n, world.size()).count(world.rank()));
+  for (int value : result) {
+    EXPECT_EQ(value, world.size());
+  }
+}
+
+TEST(result_placement_tests, check_gather_placements) {
+  boost::mpi::communicator world;
+  const int n = 13;
+  ppc::mpi::BlockPartition blocks(n, world.size());
+  std::vector<int> local(blocks.count(world.rank()));
+  for (size_t i = 0; i < local.size(); i++) {
+    local[i] = blocks.offset(world.rank()) + static_cast<int>(i);
+  }
+
+  for (auto placement :
+       {ppc::core::TaskData::ROOT, ppc::core::TaskData::ALL_RANKS, ppc::core::TaskData::DISTRIBUTED}) {
+    auto taskData = placed(placement);
+    std::vector<int> result;
+    ppc::mpi::gather_result<int>(world, taskData, local, blocks, result);
+
+    if (placement == ppc::core::TaskData::DISTRIBUTED) {
+      EXPECT_EQ(result, local);
+    } else if (placement == ppc::core::TaskData::ROOT && world.rank() != 0) {
+      EXPECT_TRUE(result.empty());
+    } else {
+      ASSERT_EQ(static_cast<int>(result.size()), n);
+      for (int i = 0; i < n; i++) {
+        EXPECT_EQ(result[i], i);
+      }
+    }
+  }
+}
+
+TEST(result_placement_tests, check_gather_of_blocks_sized_by_ranks) {
+  boost::mpi::communicator world;
+  // rank r holds r + 1 elements, a split no BlockPartition gives
+  const int n = world.size() * (world.size() + 1) / 2;
+  const int offset = world.rank() * (world.rank() + 1) / 2;
+  std::vector<int> local(world.rank() + 1);
+  for (size_t i = 0; i < local.size(); i++) {
+    local[i] = offset + static_cast<int>(i);
+  }
+
+  for (auto placement :
+       {ppc::core::TaskData::ROOT, ppc::core::TaskData::ALL_RANKS, ppc::core::TaskData::DISTRIBUTED}) {
+    auto taskData = placed(placement);
+    std::vector<int> result;
+    ppc::mpi::gather_result<int>(world, taskData, local, result);
+
+    if (placement == ppc::core::TaskData::DISTRIBUTED) {
+      EXPECT_EQ(result, local);
+    } else if (placement == ppc::core::TaskData::ROOT && world.rank() != 0) {
+      EXPECT_TRUE(result.empty());
+    } else {
+      ASSERT_EQ(static_cast<int>(result.size()), n);
+      for (int i = 0; i < n; i++) {
+        EXPECT_EQ(result[i], i);
+      }
+    }
+  }
+}
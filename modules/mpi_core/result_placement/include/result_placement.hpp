@@ -0,0 +1,141 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_RESULT_PLACEMENT_HPP_
+#define MODULES_MPI_CORE_INCLUDE_RESULT_PLACEMENT_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/operations.hpp>
+#include <span>
+#include <vector>
+
+#include "core/task/include/task.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+
+namespace ppc::mpi {
+
+// Collectives that deliver the result of a task to the ranks chosen by
+// taskData.output_placement with a single call: a reduction or gather for
+// ROOT, the all- variant for ALL_RANKS instead of a reduction followed by a
+// broadcast. `Comm` may be a HierarchicalCommunicator, the unqualified
+// calls pick its two-level overloads.
+
+// whether the current rank writes outputs of a result combined from all ranks
+inline bool holds_result(const boost::mpi::communicator& comm, const ppc::core::TaskData& taskData, int root = 0) {
+  return taskData.output_placement == ppc::core::TaskData::ALL_RANKS || comm.rank() == root;
+}
+
+// A single value has no blocks to distribute, so DISTRIBUTED places it
+// on the root like ROOT.
+template <class Comm, class T, class Op>
+void reduce_result(const Comm& comm, const ppc::core::TaskData& taskData, const T& local, T& result, Op op,
+                   int root = 0) {
+  using boost::mpi::all_reduce;
+  using boost::mpi::reduce;
+  if (taskData.output_placement == ppc::core::TaskData::ALL_RANKS) {
+    all_reduce(comm, local, result, op);
+  } else if (comm.rank() == root) {
+    reduce(comm, local, result, op, root);
+  } else {
+    reduce(comm, local, op, root);
+  }
+}
+
+// n values reduced element-wise; with DISTRIBUTED rank r gets block r of
+// `owners` in `result`, with ROOT and ALL_RANKS all n values
+template <class Comm, class T, class Op>
+void reduce_result(const Comm& comm, const ppc::core::TaskData& taskData, const T* local, int n,
+                   std::vector<T>& result, Op op, int root = 0) {
+  using boost::mpi::all_reduce;
+  using boost::mpi::reduce;
+  switch (taskData.output_placement) {
+    case ppc::core::TaskData::ALL_RANKS:
+      result.resize(n);
+      all_reduce(comm, local, n, result.data(), op);
+      break;
+    case ppc::core::TaskData::DISTRIBUTED: {
+      BlockPartition owners(n, comm.size());
+      result.resize(owners.count(comm.rank()));
+      if constexpr (boost::mpi::is_mpi_op<Op, T>::value) {
+        MPI_Reduce_scatter(local, result.data(), owners.counts.data(), boost::mpi::get_mpi_datatype<T>(),
+                           boost::mpi::is_mpi_op<Op, T>::op(), comm);
+      } else {
+        std::vector<T> all(comm.rank() == root ? n : 0);
+        if (comm.rank() == root) {
+          reduce(comm, local, n, all.data(), op, root);
+        } else {
+          reduce(comm, local, n, op, root);
+        }
+        boost::mpi::scatterv(comm, all.data(), owners.counts, owners.displs, result.data(), owners.count(comm.rank()),
+                             root);
+      }
+      break;
+    }
+    default:
+      result.resize(comm.rank() == root ? n : 0);
+      if (comm.rank() == root) {
+        reduce(comm, local, n, result.data(), op, root);
+      } else {
+        reduce(comm, local, n, op, root);
+      }
+  }
+}
+
+// Blocks `local` of all ranks (block r has blocks.count(r) elements) in
+// rank order: on the root with a gather, on all ranks with an allgather;
+// with DISTRIBUTED every rank keeps its own block and nothing is sent.
+template <class T>
+void gather_result(const boost::mpi::communicator& comm, const ppc::core::TaskData& taskData,
+                   std::span<const T> local, const BlockPartition& blocks, std::vector<T>& result, int root = 0) {
+  switch (taskData.output_placement) {
+    case ppc::core::TaskData::ALL_RANKS:
+      result.resize(blocks.total());
+      MPI_Allgatherv(local.data(), static_cast<int>(local.size()), boost::mpi::get_mpi_datatype<T>(), result.data(),
+                     blocks.counts.data(), blocks.displs.data(), boost::mpi::get_mpi_datatype<T>(), comm);
+      break;
+    case ppc::core::TaskData::DISTRIBUTED:
+      result.assign(local.begin(), local.end());
+      break;
+    default:
+      if (comm.rank() == root) {
+        result.resize(blocks.total());
+        boost::mpi::gatherv(comm, local.data(), static_cast<int>(local.size()), result.data(), blocks.counts,
+                            blocks.displs, root);
+      } else {
+        result.clear();
+        boost::mpi::gatherv(comm, local.data(), static_cast<int>(local.size()), root);
+      }
+  }
+}
+
+// Like above for blocks whose split only the ranks themselves know, e.g.
+// results of the rows scatter_rows gave them: the sizes of the blocks are
+// gathered where the result goes instead of being passed in.
+template <class T>
+void gather_result(const boost::mpi::communicator& comm, const ppc::core::TaskData& taskData,
+                   std::span<const T> local, std::vector<T>& result, int root = 0) {
+  if (taskData.output_placement == ppc::core::TaskData::DISTRIBUTED) {
+    result.assign(local.begin(), local.end());
+    return;
+  }
+  int count = static_cast<int>(local.size());
+  BlockPartition blocks(0, comm.size());
+  if (taskData.output_placement == ppc::core::TaskData::ALL_RANKS) {
+    boost::mpi::all_gather(comm, count, blocks.counts);
+  } else if (comm.rank() == root) {
+    boost::mpi::gather(comm, count, blocks.counts, root);
+  } else {
+    boost::mpi::gather(comm, count, root);
+  }
+  for (int part = 1; part < comm.size(); part++) {
+    blocks.displs[part] = blocks.displs[part - 1] + blocks.counts[part - 1];
+  }
+  gather_result(comm, taskData, local, blocks, result, root);
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_RESULT_PLACEMENT_HPP_
@@ -0,0 +1,82 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/rma/include/rma_source.hpp"
+#include "mpi_core/scheduler/include/dynamic_scheduler.hpp"
+
+TEST(rma_source_tests, check_pull_view_blocks) {
+  boost::mpi::communicator world;
+  const std::uint64_t count = 103;
+  std::vector<int> data;
+  if (world.rank() == 0) {
+    data.resize(count);
+    std::iota(data.begin(), data.end(), 0);
+  }
+  ppc::mpi::LargeBlockPartition partition(count, world.size());
+  std::vector<int> storage;
+  auto local = ppc::mpi::pull_view(world, data.data(), partition, storage);
+
+  ASSERT_EQ(local.size(), partition.count(world.rank()));
+  for (std::uint64_t i = 0; i < local.size(); i++) {
+    EXPECT_EQ(local[i], static_cast<int>(partition.offset(world.rank()) + i));
+  }
+  if (world.rank() == 0) {
+    EXPECT_EQ(local.data(), data.data());
+  }
+}
+
+TEST(rma_source_tests, check_pull_view_overlapping_blocks) {
+  boost::mpi::communicator world;
+  // every rank takes its block and the first element of the next one
+  const std::uint64_t block = 5;
+  const std::uint64_t count = (block * world.size()) + 1;
+  std::vector<int> data;
+  if (world.rank() == 0) {
+    data.resize(count);
+    std::iota(data.begin(), data.end(), 10);
+  }
+  std::vector<int> storage;
+  auto local = ppc::mpi::pull_view(world, data.data(), count, block * world.rank(), block + 1, storage);
+
+  ASSERT_EQ(local.size(), block + 1);
+  for (std::uint64_t i = 0; i <= block; i++) {
+    EXPECT_EQ(local[i], static_cast<int>(10 + (block * world.rank()) + i));
+  }
+}
+
+TEST(rma_source_tests, check_chunks_on_demand) {
+  boost::mpi::communicator world;
+  const std::int64_t count = 1000;
+  std::vector<std::int64_t> data;
+  if (world.rank() == 0) {
+    data.resize(count);
+    std::iota(data.begin(), data.end(), 1);
+  }
+
+  std::int64_t local_sum = 0;
+  {
+    ppc::mpi::RmaSource<std::int64_t> source(world, data.data(), count);
+    ppc::mpi::DynamicScheduler scheduler(world, count, 37);
+    std::vector<std::int64_t> chunk;
+    scheduler.for_each([&](std::int64_t begin, std::int64_t end) {
+      chunk.resize(end - begin);
+      source.get(begin, chunk);
+      local_sum = std::accumulate(chunk.begin(), chunk.end(), local_sum);
+    });
+  }
+
+  std::int64_t sum = 0;
+  boost::mpi::reduce(world, local_sum, sum, std::plus(), 0);
+  if (world.rank() == 0) {
+    EXPECT_EQ(sum, count * (count + 1) / 2);
+  }
+}
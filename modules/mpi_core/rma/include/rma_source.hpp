@@ -0,0 +1,96 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_RMA_SOURCE_HPP_
+#define MODULES_MPI_CORE_INCLUDE_RMA_SOURCE_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "mpi_core/large_count/include/large_count.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+
+namespace ppc::mpi {
+
+// Read-only buffer of the root exposed in an RMA window. Every rank pulls
+// the parts it needs with MPI_Get whenever it needs them, all ranks at the
+// same time, instead of waiting for the root to send the blocks one after
+// another. Works with a static partition as well as with chunks taken from
+// a DynamicScheduler. Construction and destruction are collective.
+template <class T>
+class RmaSource {
+ public:
+  // `data` of `count` elements is significant only on the root and must
+  // stay alive and unchanged while the source exists
+  RmaSource(const boost::mpi::communicator& comm, const T* data, std::uint64_t count, int root = 0) : root_(root) {
+    bool is_root = comm.rank() == root;
+    if (is_root) {
+      data_ = data;
+    }
+    // the root reads its own buffer directly, a single rank needs no window
+    if (comm.size() > 1) {
+      MPI_Aint size = is_root ? static_cast<MPI_Aint>(count * sizeof(T)) : 0;
+      void* base = is_root ? const_cast<T*>(data) : nullptr;
+      MPI_Win_create(base, size, sizeof(T), MPI_INFO_NULL, comm, &win_);
+      MPI_Win_lock_all(MPI_MODE_NOCHECK, win_);
+    }
+  }
+  RmaSource(const RmaSource&) = delete;
+  RmaSource& operator=(const RmaSource&) = delete;
+  ~RmaSource() {
+    if (win_ != MPI_WIN_NULL) {
+      MPI_Win_unlock_all(win_);
+      MPI_Win_free(&win_);
+    }
+  }
+
+  // copies elements [offset, offset + out.size()) of the root buffer
+  void get(std::uint64_t offset, std::span<T> out) {
+    if (data_ != nullptr) {
+      std::copy(data_ + offset, data_ + offset + out.size(), out.begin());
+      return;
+    }
+    for_each_chunk(out.size(), kMaxCount, [&](std::uint64_t chunk, int n) {
+      MPI_Get(out.data() + chunk, n, boost::mpi::get_mpi_datatype<T>(), root_,
+              static_cast<MPI_Aint>(offset + chunk), n, boost::mpi::get_mpi_datatype<T>(), win_);
+    });
+    MPI_Win_flush(root_, win_);
+  }
+
+ private:
+  int root_;
+  const T* data_{};
+  MPI_Win win_ = MPI_WIN_NULL;
+};
+
+// Block [offset, offset + count) of the root buffer `data` of `total`
+// elements (both significant only on the root) pulled by every rank, the
+// counterpart of scatter_view: the root's own block is a view into `data`,
+// other ranks get theirs into `storage`. Blocks of ranks may overlap.
+template <class T>
+std::span<const T> pull_view(const boost::mpi::communicator& world, const T* data, std::uint64_t total,
+                             std::uint64_t offset, std::uint64_t count, std::vector<T>& storage, int root = 0) {
+  RmaSource<T> source(world, data, total, root);
+  if (world.rank() == root) {
+    return {data + offset, count};
+  }
+  storage.resize(count);
+  source.get(offset, storage);
+  return storage;
+}
+
+template <class T>
+std::span<const T> pull_view(const boost::mpi::communicator& world, const T* data, const LargeBlockPartition& partition,
+                             std::vector<T>& storage, int root = 0) {
+  int rank = world.rank();
+  return pull_view(world, data, partition.total(), partition.offset(rank), partition.count(rank), storage, root);
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_RMA_SOURCE_HPP_
@@ -0,0 +1,129 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "core/generator/include/generator.hpp"
+#include "core/matrix/include/matrix.hpp"
+#include "core/task/include/task.hpp"
+#include "mpi_core/distributed_input/include/distributed_input.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
+
+TEST(scatter_tests, check_root_block_is_not_copied) {
+  boost::mpi::communicator world;
+  std::vector<double> in(37);
+  std::iota(in.begin(), in.end(), 0.5);
+  ppc::mpi::BlockPartition partition(static_cast<int>(in.size()), world.size());
+
+  std::vector<double> storage;
+  auto local = ppc::mpi::scatter_view(world, world.rank() == 0 ? in.data() : nullptr, partition, storage);
+  ASSERT_EQ(static_cast<int>(local.size()), partition.count(world.rank()));
+  if (world.rank() == 0) {
+    EXPECT_EQ(local.data(), in.data());
+    EXPECT_TRUE(storage.empty());
+  }
+  for (size_t i = 0; i < local.size(); i++) {
+    EXPECT_EQ(local[i], partition.offset(world.rank()) + static_cast<double>(i) + 0.5);
+  }
+}
+
+TEST(scatter_tests, check_uneven_large_partition) {
+  boost::mpi::communicator world;
+  // blocks of whole 5-element rows differ from the even split of 35 elements
+  const std::uint64_t rows = 7;
+  const std::uint64_t row_length = 5;
+  std::vector<int> in(rows * row_length);
+  std::iota(in.begin(), in.end(), 0);
+  auto partition = ppc::mpi::row_block_partition(rows, row_length, world.size());
+
+  std::vector<int> storage;
+  auto local = ppc::mpi::scatter_view(world, world.rank() == 0 ? in.data() : nullptr, partition, storage);
+  ASSERT_EQ(local.size(), partition.count(world.rank()));
+  for (size_t i = 0; i < local.size(); i++) {
+    EXPECT_EQ(local[i], static_cast<int>(partition.offset(world.rank()) + i));
+  }
+}
+
+TEST(scatter_tests, check_scatter_rows_of_padded_matrix) {
+  boost::mpi::communicator world;
+  const std::size_t rows = 2 * world.size() + 1;
+  const std::size_t cols = 3;
+  ppc::core::Matrix<int> matrix;
+  if (world.rank() == 0) {
+    matrix = ppc::core::Matrix<int>(rows, cols);
+    for (std::size_t i = 0; i < rows; i++) {
+      std::iota(matrix.row(i).begin(), matrix.row(i).end(), static_cast<int>(i * cols));
+    }
+  }
+
+  std::vector<int> storage;
+  auto local = ppc::mpi::scatter_rows(world, matrix, storage);
+  ppc::mpi::LargeBlockPartition partition(rows, world.size());
+  ASSERT_EQ(local.rows(), partition.count(world.rank()));
+  ASSERT_EQ(local.cols(), cols);
+  if (world.rank() == 0) {
+    EXPECT_EQ(local.data(), matrix.data());
+  }
+  for (std::size_t i = 0; i < local.rows(); i++) {
+    for (std::size_t j = 0; j < cols; j++) {
+      EXPECT_EQ(local(i, j), static_cast<int>(((partition.offset(world.rank()) + i) * cols) + j));
+    }
+  }
+}
+
+TEST(scatter_tests, check_scatter_input_from_task_data) {
+  boost::mpi::communicator world;
+  std::vector<int> in(2 * world.size() + 1);
+  std::iota(in.begin(), in.end(), 0);
+  ppc::core::TaskData taskData;
+  if (world.rank() == 0) {
+    taskData.inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskData.inputs_count.emplace_back(in.size());
+  }
+
+  std::vector<int> storage;
+  auto local = ppc::mpi::scatter_input<int>(world, taskData, storage);
+  ppc::mpi::BlockPartition partition(static_cast<int>(in.size()), world.size());
+  ASSERT_EQ(static_cast<int>(local.size()), partition.count(world.rank()));
+  for (size_t i = 0; i < local.size(); i++) {
+    EXPECT_EQ(local[i], partition.offset(world.rank()) + static_cast<int>(i));
+  }
+}
+
+TEST(scatter_tests, check_scatter_input_empty) {
+  boost::mpi::communicator world;
+  std::vector<int> in;
+  ppc::core::TaskData taskData;
+  if (world.rank() == 0) {
+    taskData.inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+    taskData.inputs_count.emplace_back(in.size());
+  }
+
+  std::vector<int> storage;
+  EXPECT_TRUE(ppc::mpi::scatter_input<int>(world, taskData, storage).empty());
+}
+
+TEST(scatter_tests, check_scatter_input_keeps_distributed_block) {
+  boost::mpi::communicator world;
+  std::vector<int> block;
+  ppc::core::TaskData taskData;
+  ppc::mpi::add_distributed_input(world, taskData, block, 25, ppc::core::CounterGenerator<int>(3, 0, 9));
+
+  std::vector<int> storage;
+  auto local = ppc::mpi::scatter_input<int>(world, taskData, storage);
+  EXPECT_EQ(local.data(), block.data());
+  EXPECT_EQ(local.size(), block.size());
+  EXPECT_TRUE(storage.empty());
+}
+
+TEST(scatter_tests, check_block_offset_of_uneven_blocks) {
+  boost::mpi::communicator world;
+  // rank r holds r + 1 elements, so r (r + 1) / 2 come before it
+  auto rank = static_cast<std::uint64_t>(world.rank());
+  EXPECT_EQ(ppc::mpi::block_offset(world, rank + 1), rank * (rank + 1) / 2);
+}
@@ -0,0 +1,123 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_SCATTER_HPP_
+#define MODULES_MPI_CORE_INCLUDE_SCATTER_HPP_
+
+#include <mpi.h>
+
+#include <array>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "core/matrix/include/matrix.hpp"
+#include "core/task/include/task.hpp"
+#include "mpi_core/large_count/include/large_count.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+
+namespace ppc::mpi {
+
+// Scatter of blocks straight from the caller's buffer `data` (significant
+// only on the root). The root doesn't copy anything, its own block is a view
+// into `data`; other ranks receive into `storage`. Returns the block of the
+// current rank, valid while `data` (on the root) or `storage` is alive.
+template <class T>
+std::span<const T> scatter_view(const boost::mpi::communicator& world, const T* data, const BlockPartition& partition,
+                                std::vector<T>& storage, int root = 0) {
+  MPI_Datatype type = boost::mpi::get_mpi_datatype<T>();
+  int rank = world.rank();
+  if (rank == root) {
+    MPI_Scatterv(data, partition.counts.data(), partition.displs.data(), type, MPI_IN_PLACE, partition.count(rank),
+                 type, root, world);
+    return {data + partition.offset(rank), static_cast<std::size_t>(partition.count(rank))};
+  }
+  storage.resize(partition.count(rank));
+  MPI_Scatterv(nullptr, nullptr, nullptr, type, storage.data(), partition.count(rank), type, root, world);
+  return storage;
+}
+
+// Same for inputs beyond int: blocks that fit the int counts and
+// displacements of MPI_Scatterv are scattered as above, otherwise the root
+// sends every block in chunks.
+template <class T>
+std::span<const T> scatter_view(const boost::mpi::communicator& world, const T* data,
+                                const LargeBlockPartition& partition, std::vector<T>& storage, int root = 0,
+                                std::uint64_t max_chunk = kMaxCount) {
+  if (partition.total() <= max_chunk) {
+    // same blocks with int counts, they need not be the even split
+    BlockPartition blocks(0, world.size());
+    blocks.counts.assign(partition.counts.begin(), partition.counts.end());
+    blocks.displs.assign(partition.displs.begin(), partition.displs.end());
+    return scatter_view(world, data, blocks, storage, root);
+  }
+  MPI_Datatype type = boost::mpi::get_mpi_datatype<T>();
+  int rank = world.rank();
+  if (rank == root) {
+    std::vector<MPI_Request> requests;
+    for (int proc = 0; proc < world.size(); proc++) {
+      if (proc != root) {
+        for_each_chunk(partition.count(proc), max_chunk, [&](std::uint64_t offset, int n) {
+          requests.emplace_back();
+          MPI_Isend(data + partition.offset(proc) + offset, n, type, proc, 0, world, &requests.back());
+        });
+      }
+    }
+    MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+    return {data + partition.offset(rank), partition.count(rank)};
+  }
+  storage.resize(partition.count(rank));
+  recv_large(world, storage.data(), storage.size(), root, 0, max_chunk);
+  return storage;
+}
+
+// Offset of the block of `count` elements of the current rank in the
+// blocks of all ranks taken in rank order (an exclusive scan of the counts).
+inline std::uint64_t block_offset(const boost::mpi::communicator& world, std::uint64_t count) {
+  std::uint64_t offset = 0;
+  MPI_Exscan(&count, &offset, 1, MPI_UINT64_T, MPI_SUM, world);
+  return world.rank() == 0 ? 0 : offset;
+}
+
+// Block of input `index` of `taskData` for the current rank. A distributed
+// input is already split, so the local block is returned as is; otherwise
+// the size is broadcast from the root and the input is scattered from
+// taskData->inputs[index] without copying it on the root.
+template <class T>
+std::span<const T> scatter_input(const boost::mpi::communicator& world, const ppc::core::TaskData& taskData,
+                                 std::vector<T>& storage, std::size_t index = 0, int root = 0) {
+  if (taskData.distributed) {
+    return {reinterpret_cast<const T*>(taskData.inputs[index]), taskData.inputs_count[index]};
+  }
+  std::uint64_t count = 0;
+  const T* data = nullptr;
+  if (world.rank() == root) {
+    count = taskData.inputs_count[index];
+    data = reinterpret_cast<const T*>(taskData.inputs[index]);
+  }
+  boost::mpi::broadcast(world, count, root);
+  return scatter_view(world, data, LargeBlockPartition(count, world.size()), storage, root);
+}
+
+// Blocks of whole rows of `matrix` (significant only on the root, where
+// data() must be followed by rows * ld() elements, as in owning matrices
+// and those from matrix_from_rows). The shape is broadcast from the root;
+// every rank gets the rows of block r of LargeBlockPartition(rows, size) as
+// a view with the root's ld, on the root into `matrix` itself.
+template <class T>
+ppc::core::Matrix<const T> scatter_rows(const boost::mpi::communicator& world, const ppc::core::Matrix<T>& matrix,
+                                        std::vector<T>& storage, int root = 0) {
+  std::array<std::uint64_t, 3> shape{matrix.rows(), matrix.cols(), matrix.ld()};
+  boost::mpi::broadcast(world, shape.data(), static_cast<int>(shape.size()), root);
+  LargeBlockPartition rows(shape[0], world.size());
+  auto local = scatter_view(world, world.rank() == root ? matrix.data() : nullptr,
+                            row_block_partition(shape[0], shape[2], world.size()), storage, root);
+  return ppc::core::Matrix<const T>::view(local.data(), rows.count(world.rank()), shape[1], shape[2]);
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_SCATTER_HPP_
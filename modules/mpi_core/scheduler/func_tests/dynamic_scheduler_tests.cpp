@@ -0,0 +1,71 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "mpi_core/scheduler/include/dynamic_scheduler.hpp"
+
+namespace {
+
+// how many times every index was taken over all ranks
+std::vector<int> take_all(const boost::mpi::communicator& world, std::int64_t count, std::int64_t chunk) {
+  std::vector<int> taken(count);
+  {
+    ppc::mpi::DynamicScheduler scheduler(world, count, chunk);
+    scheduler.for_each([&](std::int64_t begin, std::int64_t end) {
+      for (std::int64_t i = begin; i < end; i++) {
+        taken[i]++;
+      }
+    });
+  }
+  std::vector<int> total(count);
+  boost::mpi::all_reduce(world, taken.data(), static_cast<int>(count), total.data(), std::plus<int>());
+  return total;
+}
+
+}  // namespace
+
+TEST(dynamic_scheduler_tests, check_every_index_taken_once) {
+  boost::mpi::communicator world;
+  for (std::int64_t chunk : {0, 1, 7, 1000}) {
+    auto taken = take_all(world, 253, chunk);
+    for (int count : taken) {
+      ASSERT_EQ(count, 1);
+    }
+  }
+}
+
+TEST(dynamic_scheduler_tests, check_empty_range) {
+  boost::mpi::communicator world;
+  ppc::mpi::DynamicScheduler scheduler(world, 0);
+  EXPECT_FALSE(scheduler.next().has_value());
+}
+
+TEST(dynamic_scheduler_tests, check_slow_rank_takes_less) {
+  boost::mpi::communicator world;
+  if (world.size() < 2) {
+    GTEST_SKIP();
+  }
+  int chunks = 0;
+  {
+    ppc::mpi::DynamicScheduler scheduler(world, 40, 1);
+    scheduler.for_each([&](std::int64_t, std::int64_t) {
+      chunks++;
+      if (world.rank() == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      }
+    });
+  }
+  std::vector<int> all;
+  boost::mpi::gather(world, chunks, all, 0);
+  if (world.rank() == 0) {
+    // a static split would give rank 0 at least 40 / size chunks
+    EXPECT_LT(all[0], 40 / world.size());
+  }
+}
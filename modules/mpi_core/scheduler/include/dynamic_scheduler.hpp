@@ -0,0 +1,58 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_DYNAMIC_SCHEDULER_HPP_
+#define MODULES_MPI_CORE_INCLUDE_DYNAMIC_SCHEDULER_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstdint>
+#include <optional>
+
+#include "mpi_core/progress/include/progress.hpp"
+
+namespace ppc::mpi {
+
+// Chunks of the index range [0, count) handed out to ranks on demand, so
+// ranks that get cheap iterations simply take more chunks. The next free
+// index is a counter in an RMA window on rank 0 advanced with an atomic
+// MPI_Fetch_and_op; rank 0 works like any other rank, there is no master
+// waiting for requests. Construction and destruction are collective.
+class DynamicScheduler {
+ public:
+  // chunk = 0 picks count / (8 * size) rounded up
+  DynamicScheduler(const boost::mpi::communicator& comm, std::int64_t count, std::int64_t chunk = 0);
+  DynamicScheduler(const DynamicScheduler&) = delete;
+  DynamicScheduler& operator=(const DynamicScheduler&) = delete;
+  ~DynamicScheduler();
+
+  struct Chunk {
+    std::int64_t begin;
+    std::int64_t end;
+  };
+
+  // next chunk for the calling rank, nothing when the range is exhausted
+  std::optional<Chunk> next();
+
+  [[nodiscard]] std::int64_t chunk() const { return chunk_; }
+
+  // calls body(begin, end) for every chunk taken by the calling rank,
+  // polling for progress after each of them
+  template <class Body>
+  void for_each(Body&& body) {
+    while (auto chunk = next()) {
+      body(chunk->begin, chunk->end);
+      poll_progress();
+    }
+  }
+
+ private:
+  std::int64_t count_;
+  std::int64_t chunk_;
+  std::int64_t* counter_{};
+  MPI_Win win_{};
+};
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_DYNAMIC_SCHEDULER_HPP_
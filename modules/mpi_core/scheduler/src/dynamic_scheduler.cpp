@@ -0,0 +1,45 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi_core/scheduler/include/dynamic_scheduler.hpp"
+
+#include <algorithm>
+
+namespace {
+
+// about 8 chunks per rank: enough to even out the load, few enough to keep
+// the counter cold
+std::int64_t default_chunk(std::int64_t count, int size) {
+  std::int64_t chunks = 8 * static_cast<std::int64_t>(size);
+  return std::max<std::int64_t>(1, (count + chunks - 1) / chunks);
+}
+
+}  // namespace
+
+ppc::mpi::DynamicScheduler::DynamicScheduler(const boost::mpi::communicator& comm, std::int64_t count,
+                                             std::int64_t chunk)
+    : count_(count), chunk_(chunk > 0 ? chunk : default_chunk(count, comm.size())) {
+  MPI_Aint size = comm.rank() == 0 ? sizeof(std::int64_t) : 0;
+  MPI_Win_allocate(size, sizeof(std::int64_t), MPI_INFO_NULL, comm, &counter_, &win_);
+  if (comm.rank() == 0) {
+    MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, win_);
+    *counter_ = 0;
+    MPI_Win_unlock(0, win_);
+  }
+  // nobody takes a chunk before the counter is set
+  MPI_Barrier(comm);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, win_);
+}
+
+ppc::mpi::DynamicScheduler::~DynamicScheduler() {
+  MPI_Win_unlock_all(win_);
+  MPI_Win_free(&win_);
+}
+
+std::optional<ppc::mpi::DynamicScheduler::Chunk> ppc::mpi::DynamicScheduler::next() {
+  std::int64_t begin = 0;
+  MPI_Fetch_and_op(&chunk_, &begin, MPI_INT64_T, 0, 0, MPI_SUM, win_);
+  MPI_Win_flush(0, win_);
+  if (begin >= count_) {
+    return std::nullopt;
+  }
+  return Chunk{begin, std::min(begin + chunk_, count_)};
+}
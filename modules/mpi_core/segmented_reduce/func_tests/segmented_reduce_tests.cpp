@@ -0,0 +1,96 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/operations.hpp>
+#include <climits>
+#include <functional>
+#include <vector>
+
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/segmented_reduce/include/segmented_reduce.hpp"
+
+namespace {
+
+// row-major rows x cols matrix with a[i][j] = (i * 7 + j * 13) % 101
+std::vector<int> make_matrix(int rows, int cols) {
+  std::vector<int> matrix(rows * cols);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      matrix[i * cols + j] = (i * 7 + j * 13) % 101;
+    }
+  }
+  return matrix;
+}
+
+}  // namespace
+
+TEST(segmented_reduce_tests, check_rows_split_between_ranks) {
+  boost::mpi::communicator world;
+  const int rows = 17;
+  const int cols = 5;
+  auto matrix = make_matrix(rows, cols);
+
+  // blocks don't follow row boundaries
+  ppc::mpi::BlockPartition partition(rows * cols, world.size());
+  std::span<const int> block(matrix.data() + partition.offset(world.rank()), partition.count(world.rank()));
+
+  ppc::mpi::SegmentedReduction<int, boost::mpi::maximum<int>> rows_max(rows, INT_MIN);
+  rows_max.add_rows(partition.offset(world.rank()), block, cols);
+  std::vector<int> result;
+  rows_max.reduce(world, result, 0);
+
+  if (world.rank() == 0) {
+    ASSERT_EQ(static_cast<int>(result.size()), rows);
+    for (int i = 0; i < rows; i++) {
+      EXPECT_EQ(result[i], *std::max_element(matrix.begin() + i * cols, matrix.begin() + (i + 1) * cols));
+    }
+  }
+}
+
+TEST(segmented_reduce_tests, check_padding_is_ignored) {
+  ppc::mpi::SegmentedReduction<int, boost::mpi::minimum<int>> rows_min(2, INT_MAX);
+  std::vector<int> block = {5, 3, 4, 9, 8, 7, -1};
+  rows_min.add_rows(0, block, 3);
+  EXPECT_EQ(rows_min.partials()[0], 3);
+  EXPECT_EQ(rows_min.partials()[1], 7);
+}
+
+TEST(segmented_reduce_tests, check_reduce_scatter_by_owner) {
+  boost::mpi::communicator world;
+  const int segments = 11;
+  ppc::mpi::SegmentedReduction<int, std::plus<int>> sums(segments, 0);
+  for (int segment = 0; segment < segments; segment++) {
+    sums.add(segment, world.rank() + segment);
+  }
+
+  ppc::mpi::BlockPartition owners(segments, world.size());
+  std::vector<int> local;
+  sums.reduce_scatter(world, owners, local);
+
+  int ranks_sum = world.size() * (world.size() - 1) / 2;
+  ASSERT_EQ(static_cast<int>(local.size()), owners.count(world.rank()));
+  for (int i = 0; i < owners.count(world.rank()); i++) {
+    EXPECT_EQ(local[i], ranks_sum + world.size() * (owners.offset(world.rank()) + i));
+  }
+}
+
+TEST(segmented_reduce_tests, check_reduce_scatter_custom_op) {
+  boost::mpi::communicator world;
+  auto op = [](double a, double b) { return std::max(a, b); };
+  ppc::mpi::SegmentedReduction<double, decltype(op)> maxima(6, -1.0, op);
+  maxima.add(world.rank() % 6, static_cast<double>(world.rank()));
+
+  ppc::mpi::BlockPartition owners(6, world.size());
+  std::vector<double> local;
+  maxima.reduce_scatter(world, owners, local);
+  for (int i = 0; i < owners.count(world.rank()); i++) {
+    int segment = owners.offset(world.rank()) + i;
+    double expected = -1.0;
+    for (int rank = segment; rank < world.size(); rank += 6) {
+      expected = rank;
+    }
+    EXPECT_EQ(local[i], expected);
+  }
+}
@@ -0,0 +1,104 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_SEGMENTED_REDUCE_HPP_
+#define MODULES_MPI_CORE_INCLUDE_SEGMENTED_REDUCE_HPP_
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <boost/mpi/operations.hpp>
+#include <cstddef>
+#include <numeric>
+#include <span>
+#include <vector>
+
+#include "mpi_core/nonblocking/include/nonblocking.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/progress/include/progress.hpp"
+
+namespace ppc::mpi {
+
+// Per-segment reduction (e.g. maximum of every row of a matrix) where every
+// rank holds partial results only for the segments it touched. All
+// segments are combined with a single vector reduction instead of one
+// collective per segment, segments not touched by a rank hold `identity`.
+template <class T, class Op>
+class SegmentedReduction {
+ public:
+  SegmentedReduction(int num_segments, T identity, Op op = Op())
+      : partials_(num_segments, identity), identity_(identity), op_(op) {}
+
+  // combine `value` into the partial result of `segment`
+  void add(int segment, const T& value) { partials_[segment] = op_(partials_[segment], value); }
+
+  // combine a contiguous block of a row-major matrix with rows of
+  // `row_length` elements, `offset` is the matrix index of block[0];
+  // elements after the last segment (padding) are ignored
+  void add_rows(std::size_t offset, std::span<const T> block, std::size_t row_length) {
+    add_rows(offset, block, row_length, 0, partials_.size());
+  }
+
+  // same, but only the elements of the block in segments [first, last)
+  void add_rows(std::size_t offset, std::span<const T> block, std::size_t row_length, std::size_t first,
+                std::size_t last) {
+    auto clip = [&](std::size_t segment) {
+      std::size_t index = std::min(segment, partials_.size()) * row_length;
+      return std::clamp(index, offset, offset + block.size()) - offset;
+    };
+    std::size_t begin = clip(first);
+    std::size_t stop = clip(last);
+    while (begin < stop) {
+      std::size_t row = (offset + begin) / row_length;
+      std::size_t end = std::min(stop, (row + 1) * row_length - offset);
+      partials_[row] = std::accumulate(block.begin() + begin, block.begin() + end, partials_[row], op_);
+      begin = end;
+      // reductions of earlier segments may be in flight
+      poll_progress();
+    }
+  }
+
+  // all segments on the root
+  void reduce(const boost::mpi::communicator& comm, std::vector<T>& result, int root) const {
+    if (comm.rank() == root) {
+      result.resize(partials_.size());
+      boost::mpi::reduce(comm, partials_.data(), static_cast<int>(partials_.size()), result.data(), op_, root);
+    } else {
+      boost::mpi::reduce(comm, partials_.data(), static_cast<int>(partials_.size()), op_, root);
+    }
+  }
+
+  // start reducing segments [first, first + count) to the root, the other
+  // segments may still be combined while it is in flight
+  PendingReduction<T> ireduce(const boost::mpi::communicator& comm, int first, int count, int root) const {
+    return ppc::mpi::ireduce(comm, partials_.data() + first, count, op_, root);
+  }
+
+  // segments of `owners` block r on rank r
+  void reduce_scatter(const boost::mpi::communicator& comm, const BlockPartition& owners, std::vector<T>& local) const {
+    local.resize(owners.count(comm.rank()));
+    if constexpr (boost::mpi::is_mpi_op<Op, T>::value) {
+      MPI_Reduce_scatter(partials_.data(), local.data(), owners.counts.data(), boost::mpi::get_mpi_datatype<T>(),
+                         boost::mpi::is_mpi_op<Op, T>::op(), comm);
+    } else {
+      std::vector<T> all;
+      reduce(comm, all, 0);
+      boost::mpi::scatterv(comm, all.data(), owners.counts, owners.displs, local.data(), owners.count(comm.rank()),
+                           0);
+    }
+  }
+
+  [[nodiscard]] std::span<const T> partials() const { return partials_; }
+  [[nodiscard]] const T& identity() const { return identity_; }
+
+ private:
+  std::vector<T> partials_;
+  T identity_;
+  Op op_;
+};
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_SEGMENTED_REDUCE_HPP_
@@ -0,0 +1,82 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <numeric>
+#include <vector>
+
+#include "mpi_core/shared_window/include/shared_window.hpp"
+#include "mpi_core/topology/include/topology.hpp"
+
+TEST(shared_window_tests, check_whole_buffer_on_every_rank) {
+  boost::mpi::communicator world;
+  ppc::mpi::NodeTopology topology(world);
+
+  std::vector<int> in;
+  if (world.rank() == 0) {
+    in = std::vector<int>(1000);
+    std::iota(in.begin(), in.end(), 0);
+  }
+
+  ppc::mpi::SharedWindow<int> window(topology, in.data(), static_cast<int>(in.size()));
+  auto local = window.local();
+  ASSERT_EQ(local.size(), 1000u);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_EQ(local[i], i);
+  }
+}
+
+TEST(shared_window_tests, check_blocks_by_rank) {
+  boost::mpi::communicator world;
+  ppc::mpi::NodeTopology topology(world);
+
+  std::vector<int> counts(world.size());
+  std::iota(counts.begin(), counts.end(), 1);
+  int total = std::accumulate(counts.begin(), counts.end(), 0);
+
+  std::vector<double> in;
+  if (world.rank() == 0) {
+    in = std::vector<double>(total);
+    std::iota(in.begin(), in.end(), 0.0);
+  }
+
+  ppc::mpi::SharedWindow<double> window(topology, in.data(), counts);
+  auto local = window.local();
+  int first = world.rank() * (world.rank() + 1) / 2;
+  ASSERT_EQ(static_cast<int>(local.size()), counts[world.rank()]);
+  for (int i = 0; i < counts[world.rank()]; i++) {
+    ASSERT_EQ(local[i], first + i);
+  }
+}
+
+TEST(shared_window_tests, check_scatter_across_emulated_nodes) {
+  boost::mpi::communicator world;
+  int root = world.size() - 1;
+  ppc::mpi::NodeTopology topology(world, root, 2);
+
+  std::vector<int> counts(world.size(), 3);
+  std::vector<int> in;
+  if (world.rank() == root) {
+    in = std::vector<int>(3 * world.size());
+    std::iota(in.begin(), in.end(), 0);
+  }
+
+  ppc::mpi::SharedWindow<int> window(topology, in.data(), counts);
+  auto local = window.local();
+  ASSERT_EQ(local.size(), 3u);
+  for (int i = 0; i < 3; i++) {
+    ASSERT_EQ(local[i], 3 * world.rank() + i);
+  }
+}
+
+TEST(shared_window_tests, check_empty_block) {
+  boost::mpi::communicator world;
+  ppc::mpi::NodeTopology topology(world, 0, 1);
+
+  std::vector<int> counts(world.size(), 0);
+  counts[0] = 5;
+  std::vector<int> in(5, 7);
+
+  ppc::mpi::SharedWindow<int> window(topology, in.data(), counts);
+  EXPECT_EQ(window.local().size(), world.rank() == 0 ? 5u : 0u);
+}
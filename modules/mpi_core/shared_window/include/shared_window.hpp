@@ -0,0 +1,137 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_SHARED_WINDOW_HPP_
+#define MODULES_MPI_CORE_INCLUDE_SHARED_WINDOW_HPP_
+
+#include <mpi.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include "mpi_core/topology/include/topology.hpp"
+
+namespace ppc::mpi {
+
+// Read-only input placed once per node in an MPI shared memory window.
+// The root copies its input into the window of its own node and sends to the
+// leader of every other node only what the ranks of that node need, after
+// that all ranks of a node read their data in place without copies.
+// Construction and destruction are collective over the world communicator.
+template <class T>
+class SharedWindow {
+  static_assert(std::is_trivially_copyable_v<T>, "SharedWindow needs trivially copyable elements");
+
+ public:
+  // Every rank sees all `count` elements of `data`. `data` and `count` are
+  // significant only on the root.
+  SharedWindow(const NodeTopology& topology, const T* data, int count) {
+    const auto& world = topology.world();
+    boost::mpi::broadcast(world, count, topology.root());
+
+    allocate(topology, count);
+    if (topology.is_leader()) {
+      if (world.rank() == topology.root()) {
+        std::memcpy(base_, data, count * sizeof(T));
+      }
+      MPI_Bcast(base_, count, element_type_, 0, topology.leaders());
+    }
+    MPI_Win_fence(0, win_);
+    local_ = std::span<const T>(base_, count);
+  }
+
+  // Rank r sees its own block of counts[r] elements. Blocks are stored in
+  // `data` one after another in rank order. `data` is significant only on
+  // the root, `counts` are needed on all ranks.
+  SharedWindow(const NodeTopology& topology, const T* data, const std::vector<int>& counts) {
+    const auto& world = topology.world();
+    std::vector<int> displs(counts.size(), 0);
+    std::exclusive_scan(counts.begin(), counts.end(), displs.begin(), 0);
+
+    int node_count = 0;
+    int offset = 0;
+    for (int member : topology.node_members()) {
+      if (member == world.rank()) {
+        offset = node_count;
+      }
+      node_count += counts[member];
+    }
+
+    allocate(topology, node_count);
+    if (topology.is_leader()) {
+      const auto& leaders = topology.leaders();
+      if (leaders.rank() == 0) {
+        const auto& members = topology.nodes();
+        std::vector<MPI_Request> requests;
+        std::vector<MPI_Datatype> types;
+        T* dst = base_;
+        for (int member : members[0]) {
+          std::memcpy(dst, data + displs[member], counts[member] * sizeof(T));
+          dst += counts[member];
+        }
+        for (int leader = 1; leader < leaders.size(); leader++) {
+          std::vector<int> block_counts;
+          std::vector<int> block_displs;
+          for (int member : members[leader]) {
+            block_counts.push_back(counts[member]);
+            block_displs.push_back(displs[member]);
+          }
+          MPI_Datatype blocks;
+          MPI_Type_indexed(static_cast<int>(block_counts.size()), block_counts.data(), block_displs.data(),
+                           element_type_, &blocks);
+          MPI_Type_commit(&blocks);
+          types.push_back(blocks);
+          requests.emplace_back();
+          MPI_Isend(data, 1, blocks, leader, 0, leaders, &requests.back());
+        }
+        MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+        for (auto& type : types) {
+          MPI_Type_free(&type);
+        }
+      } else {
+        MPI_Recv(base_, node_count, element_type_, 0, 0, leaders, MPI_STATUS_IGNORE);
+      }
+    }
+    MPI_Win_fence(0, win_);
+    local_ = std::span<const T>(base_ + offset, counts[world.rank()]);
+  }
+
+  SharedWindow(const SharedWindow&) = delete;
+  SharedWindow& operator=(const SharedWindow&) = delete;
+
+  ~SharedWindow() {
+    MPI_Win_free(&win_);
+    MPI_Type_free(&element_type_);
+  }
+
+  // data of the current rank
+  [[nodiscard]] std::span<const T> local() const { return local_; }
+
+ private:
+  void allocate(const NodeTopology& topology, int node_count) {
+    MPI_Type_contiguous(sizeof(T), MPI_BYTE, &element_type_);
+    MPI_Type_commit(&element_type_);
+
+    // the whole node segment belongs to the leader, other ranks only map it
+    MPI_Aint size = topology.is_leader() ? static_cast<MPI_Aint>(node_count) * sizeof(T) : 0;
+    T* own;
+    MPI_Win_allocate_shared(size, sizeof(T), MPI_INFO_NULL, topology.node(), &own, &win_);
+
+    int disp_unit;
+    MPI_Win_shared_query(win_, 0, &size, &disp_unit, &base_);
+    MPI_Win_fence(0, win_);
+  }
+
+  MPI_Win win_{MPI_WIN_NULL};
+  MPI_Datatype element_type_{MPI_DATATYPE_NULL};
+  T* base_{};
+  std::span<const T> local_;
+};
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_SHARED_WINDOW_HPP_
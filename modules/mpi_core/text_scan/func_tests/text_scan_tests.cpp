@@ -0,0 +1,37 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <boost/mpi/communicator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "core/simd/include/text_scan.hpp"
+#include "core/task/include/task.hpp"
+#include "mpi_core/text_scan/include/text_scan.hpp"
+
+TEST(text_scan_tests, check_blocks_match_sequential_scan) {
+  boost::mpi::communicator world;
+  // short texts leave some ranks without bytes, longer ones cut words and "..." between ranks
+  for (std::size_t repeats : {0, 1, 5, 100}) {
+    std::string text;
+    for (std::size_t i = 0; i < repeats; i++) {
+      text += "Wait... what?! Words\tand  spaces. ";
+    }
+    ppc::core::TaskData taskData;
+    taskData.output_placement = ppc::core::TaskData::ALL_RANKS;
+    const char* data = world.rank() == 0 ? text.data() : nullptr;
+    std::uint64_t n = world.rank() == 0 ? text.size() : 0;
+    auto counts = ppc::mpi::scan_text(world, taskData, data, n);
+    auto dots = ppc::mpi::count_byte(world, taskData, data, n, '.');
+
+    auto expected = ppc::core::scan_text(text.data(), text.size());
+    EXPECT_EQ(counts.bytes, expected.bytes) << repeats;
+    EXPECT_EQ(counts.letters, expected.letters) << repeats;
+    EXPECT_EQ(counts.spaces, expected.spaces) << repeats;
+    EXPECT_EQ(counts.terminators, expected.terminators) << repeats;
+    EXPECT_EQ(counts.words, 5 * repeats);
+    EXPECT_EQ(counts.sentences, 3 * repeats);
+    EXPECT_EQ(dots, 4 * repeats);
+  }
+}
@@ -0,0 +1,73 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_TEXT_SCAN_HPP_
+#define MODULES_MPI_CORE_INCLUDE_TEXT_SCAN_HPP_
+
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/datatype.hpp>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "core/simd/include/text_scan.hpp"
+#include "core/task/include/task.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/result_placement/include/result_placement.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
+
+// Counts are sent as one MPI struct type of their fields.
+namespace boost::serialization {
+template <class Archive>
+void serialize(Archive& ar, ppc::core::TextCounts& counts, const unsigned int /*version*/) {
+  ar & counts.bytes;
+  ar & counts.letters;
+  ar & counts.spaces;
+  ar & counts.terminators;
+  ar & counts.words;
+  ar & counts.sentences;
+  ar & counts.first;
+  ar & counts.last;
+}
+}  // namespace boost::serialization
+
+namespace boost::mpi {
+template <>
+struct is_mpi_datatype<ppc::core::TextCounts> : mpl::true_ {};
+}  // namespace boost::mpi
+
+namespace ppc::mpi {
+
+// Counts of the n bytes of `text` of the root on the ranks chosen by
+// taskData.output_placement. The text is scattered in blocks, every rank
+// scans its block and the counts are reduced in rank order with +, which
+// joins the words and sentences cut at the borders of the blocks.
+template <class Comm>
+ppc::core::TextCounts scan_text(const Comm& comm, const ppc::core::TaskData& taskData, const char* text,
+                                std::uint64_t n, int root = 0) {
+  boost::mpi::broadcast(comm, n, root);
+  std::vector<char> storage;
+  auto local = scatter_view(comm, text, LargeBlockPartition(n, comm.size()), storage, root);
+  ppc::core::TextCounts result;
+  reduce_result(comm, taskData, ppc::core::scan_text(local.data(), local.size()), result,
+                std::plus<ppc::core::TextCounts>(), root);
+  return result;
+}
+
+// number of the n bytes of `text` of the root equal to `byte`, on the
+// ranks chosen by taskData.output_placement
+template <class Comm>
+std::uint64_t count_byte(const Comm& comm, const ppc::core::TaskData& taskData, const char* text, std::uint64_t n,
+                         char byte, int root = 0) {
+  boost::mpi::broadcast(comm, n, root);
+  std::vector<char> storage;
+  auto local = scatter_view(comm, text, LargeBlockPartition(n, comm.size()), storage, root);
+  std::uint64_t result = 0;
+  reduce_result(comm, taskData, ppc::core::count_byte(local.data(), local.size(), byte), result,
+                std::plus<std::uint64_t>(), root);
+  return result;
+}
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_TEXT_SCAN_HPP_
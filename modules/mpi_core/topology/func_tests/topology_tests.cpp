@@ -0,0 +1,66 @@
+// Copyright 2024 Nesterov Alexander
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/mpi/collectives.hpp>
+#include <boost/mpi/communicator.hpp>
+#include <boost/mpi/environment.hpp>
+#include <functional>
+#include <vector>
+
+#include "mpi_core/topology/include/topology.hpp"
+
+TEST(topology_tests, check_nodes_cover_world) {
+  boost::mpi::communicator world;
+  ppc::mpi::NodeTopology topology(world);
+
+  int leaders = topology.is_leader() ? 1 : 0;
+  int total_leaders = 0;
+  boost::mpi::all_reduce(world, leaders, total_leaders, std::plus());
+  EXPECT_EQ(total_leaders, topology.num_nodes());
+
+  int node_size = topology.is_leader() ? topology.node().size() : 0;
+  int total_size = 0;
+  boost::mpi::all_reduce(world, node_size, total_size, std::plus());
+  EXPECT_EQ(total_size, world.size());
+
+  ASSERT_EQ(static_cast<int>(topology.node_members().size()), topology.node().size());
+  EXPECT_EQ(topology.node_members()[topology.node().rank()], world.rank());
+}
+
+TEST(topology_tests, check_root_leads_its_node) {
+  boost::mpi::communicator world;
+  int root = world.size() - 1;
+  ppc::mpi::NodeTopology topology(world, root);
+
+  if (world.rank() == root) {
+    ASSERT_TRUE(topology.is_leader());
+    EXPECT_EQ(topology.leaders().rank(), 0);
+  }
+  const auto& members = topology.node_members();
+  if (std::find(members.begin(), members.end(), root) != members.end()) {
+    EXPECT_EQ(members[0], root);
+  }
+}
+
+TEST(topology_tests, check_emulated_nodes) {
+  boost::mpi::communicator world;
+  ppc::mpi::NodeTopology topology(world, 0, 2);
+
+  EXPECT_EQ(topology.num_nodes(), (world.size() + 1) / 2);
+  EXPECT_EQ(topology.is_leader(), world.rank() % 2 == 0);
+  if (!topology.is_leader()) {
+    EXPECT_FALSE(topology.leaders());
+  }
+}
+
+int main(int argc, char** argv) {
+  boost::mpi::environment env(argc, argv);
+  boost::mpi::communicator world;
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::TestEventListeners& listeners = ::testing::UnitTest::GetInstance()->listeners();
+  if (world.rank() != 0) {
+    delete listeners.Release(listeners.default_result_printer());
+  }
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,49 @@
+// Copyright 2024 Nesterov Alexander
+
+#ifndef MODULES_MPI_CORE_INCLUDE_TOPOLOGY_HPP_
+#define MODULES_MPI_CORE_INCLUDE_TOPOLOGY_HPP_
+
+#include <boost/mpi/communicator.hpp>
+#include <vector>
+
+namespace ppc::mpi {
+
+// Split of a communicator into shared-memory nodes. Every node gets its own
+// communicator and the first rank of every node (the leader) joins a leaders
+// communicator. The root is always the leader of its node and rank 0 of the
+// leaders communicator.
+class NodeTopology {
+ public:
+  // emulated_node_size > 0 groups consecutive ranks into fake nodes of that
+  // size instead of asking MPI which ranks share memory (for testing)
+  explicit NodeTopology(const boost::mpi::communicator& world, int root = 0, int emulated_node_size = 0);
+
+  [[nodiscard]] const boost::mpi::communicator& world() const { return world_; }
+  [[nodiscard]] const boost::mpi::communicator& node() const { return node_; }
+  // valid only on leaders
+  [[nodiscard]] const boost::mpi::communicator& leaders() const { return leaders_; }
+
+  [[nodiscard]] int root() const { return root_; }
+  [[nodiscard]] bool is_leader() const { return node_.rank() == 0; }
+  [[nodiscard]] int num_nodes() const { return num_nodes_; }
+  // rank of the current node leader in the leaders communicator
+  [[nodiscard]] int node_index() const { return node_index_; }
+  // world ranks of the current node in node rank order
+  [[nodiscard]] const std::vector<int>& node_members() const { return node_members_; }
+  // world ranks of every node indexed by node_index(), only on the root
+  [[nodiscard]] const std::vector<std::vector<int>>& nodes() const { return nodes_; }
+
+ private:
+  boost::mpi::communicator world_;
+  boost::mpi::communicator node_;
+  boost::mpi::communicator leaders_;
+  int root_;
+  int num_nodes_{};
+  int node_index_{};
+  std::vector<int> node_members_;
+  std::vector<std::vector<int>> nodes_;
+};
+
+}  // namespace ppc::mpi
+
+#endif  // MODULES_MPI_CORE_INCLUDE_TOPOLOGY_HPP_
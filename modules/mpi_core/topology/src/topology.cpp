@@ -0,0 +1,47 @@
+// Copyright 2024 Nesterov Alexander
+#include "mpi_core/topology/include/topology.hpp"
+
+#include <mpi.h>
+
+#include <boost/mpi/collectives.hpp>
+#include <vector>
+
+ppc::mpi::NodeTopology::NodeTopology(const boost::mpi::communicator& world, int root, int emulated_node_size)
+    : world_(world), root_(root) {
+  // root goes first inside its node and among the leaders
+  int key = world.rank() == root ? 0 : world.rank() + 1;
+
+  MPI_Comm node_comm;
+  if (emulated_node_size > 0) {
+    MPI_Comm_split(world, world.rank() / emulated_node_size, key, &node_comm);
+  } else {
+    MPI_Comm_split_type(world, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &node_comm);
+  }
+  node_ = boost::mpi::communicator(node_comm, boost::mpi::comm_take_ownership);
+
+  MPI_Comm leaders_comm;
+  MPI_Comm_split(world, node_.rank() == 0 ? 0 : MPI_UNDEFINED, key, &leaders_comm);
+  // MPI_COMM_NULL on non-leaders gives a null communicator
+  leaders_ = boost::mpi::communicator(leaders_comm, boost::mpi::comm_take_ownership);
+  if (leaders_) {
+    num_nodes_ = leaders_.size();
+    node_index_ = leaders_.rank();
+  }
+  boost::mpi::broadcast(node_, num_nodes_, 0);
+  boost::mpi::broadcast(node_, node_index_, 0);
+
+  boost::mpi::all_gather(node_, world.rank(), node_members_);
+
+  std::vector<int> node_of;
+  boost::mpi::gather(world, node_index_, node_of, root);
+  if (world.rank() == root) {
+    // same order as inside the nodes: root first, then by world rank
+    nodes_.resize(num_nodes_);
+    nodes_[node_of[root]].push_back(root);
+    for (int rank = 0; rank < world.size(); rank++) {
+      if (rank != root) {
+        nodes_[node_of[rank]].push_back(rank);
+      }
+    }
+  }
+}
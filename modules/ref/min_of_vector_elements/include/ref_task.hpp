@@ -10,6 +10,7 @@
 #include <numeric>
 #include <vector>
 
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ppc {
@@ -46,9 +47,10 @@ class MinOfVectorElements : public ppc::core::Task {
 
   bool run() override {
     internal_order_test();
-    auto result = std::min_element(input_.begin(), input_.end());
-    min = static_cast<InOutType>(*result);
-    min_index = static_cast<IndexType>(std::distance(input_.begin(), result));
+    // the first position of the minimum, found in the same pass as its value
+    auto result = ppc::core::arg_reduce_elements<ppc::core::MIN>(input_.data(), input_.size());
+    min = result.value;
+    min_index = static_cast<IndexType>(result.index);
     return true;
   }
 
@@ -5,6 +5,7 @@ build\bin\ref_func_tests.exe  --gtest_also_run_disabled_tests --gtest_repeat=10
 
 if "%CLANG_BUILD%" NEQ "1" mpiexec.exe -np 4 build\bin\sample_mpi.exe
 if "%CLANG_BUILD%" NEQ "1" mpiexec.exe -np 4 build\bin\sample_mpi_boost.exe
+if "%CLANG_BUILD%" NEQ "1" mpiexec.exe -np 4 build\bin\mpi_core_func_tests.exe --gtest_repeat=10 || exit 1
 if "%CLANG_BUILD%" NEQ "1" build\bin\sample_omp.exe
 build\bin\sample_stl.exe
 build\bin\sample_tbb.exe
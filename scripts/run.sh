@@ -18,9 +18,11 @@ if [[ -z "$ASAN_RUN" ]]; then
   if [[ $OSTYPE == "linux-gnu" ]]; then
     mpirun --oversubscribe -np 4 ./build/bin/sample_mpi
     mpirun --oversubscribe -np 4 ./build/bin/sample_mpi_boost
+    mpirun --oversubscribe -np 4 ./build/bin/mpi_core_func_tests --gtest_repeat=10
   elif [[ $OSTYPE == "darwin"* ]]; then
     mpirun -np 2 ./build/bin/sample_mpi
     mpirun -np 2 ./build/bin/sample_mpi_boost
+    mpirun -np 2 ./build/bin/mpi_core_func_tests --gtest_repeat=10
   fi
 fi
 ./build/bin/sample_omp
@@ -333,4 +333,47 @@ TEST(chernykh_a_num_of_alternations_signs_mpi, sign_change_at_borders_of_three_c
     ASSERT_TRUE(seq_task.post_processing());
     ASSERT_EQ(seq_output[0], par_output[0]);
   }
-}
\ No newline at end of file
+}
+
+TEST(chernykh_a_num_of_alternations_signs_mpi, all_distributions_give_same_result) {
+  auto world = boost::mpi::communicator();
+
+  // inputs shorter than the number of ranks leave blocks empty
+  for (int size : {2, 5, 1'003}) {
+    // Create data
+    auto input = std::vector<int>();
+    if (world.rank() == 0) {
+      input = getRandomVector(size);
+    }
+
+    std::vector<int> results;
+    for (auto distribution : {chernykh_a_num_of_alternations_signs_mpi::Distribution::kSendLoop,
+                              chernykh_a_num_of_alternations_signs_mpi::Distribution::kScatterv,
+                              chernykh_a_num_of_alternations_signs_mpi::Distribution::kRmaPull}) {
+      auto par_output = std::vector<int>(1, 0);
+
+      // Create TaskData
+      auto par_task_data = std::make_shared<ppc::core::TaskData>();
+      if (world.rank() == 0) {
+        par_task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+        par_task_data->inputs_count.emplace_back(input.size());
+        par_task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(par_output.data()));
+        par_task_data->outputs_count.emplace_back(par_output.size());
+      }
+
+      // Create Task
+      auto par_task = chernykh_a_num_of_alternations_signs_mpi::ParallelTask(par_task_data, distribution);
+
+      ASSERT_TRUE(par_task.validation());
+      ASSERT_TRUE(par_task.pre_processing());
+      ASSERT_TRUE(par_task.run());
+      ASSERT_TRUE(par_task.post_processing());
+      results.push_back(par_output[0]);
+    }
+
+    if (world.rank() == 0) {
+      ASSERT_EQ(results[0], results[1]) << size;
+      ASSERT_EQ(results[0], results[2]) << size;
+    }
+  }
+}
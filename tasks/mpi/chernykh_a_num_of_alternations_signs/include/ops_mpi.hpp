@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/mpi/communicator.hpp>
+#include <span>
 #include <vector>
 
 #include "core/task/include/task.hpp"
@@ -20,16 +21,31 @@ class SequentialTask : public ppc::core::Task {
   int result{};
 };
 
+// how the root input reaches the ranks
+enum class Distribution {
+  kSendLoop,  // root sends the chunks one rank after another
+  kScatterv,  // one MPI_Scatterv
+  kRmaPull,   // every rank gets its chunk from a window on the root
+};
+
 class ParallelTask : public ppc::core::Task {
  public:
-  explicit ParallelTask(std::shared_ptr<ppc::core::TaskData> task_data) : Task(std::move(task_data)) {}
+  explicit ParallelTask(std::shared_ptr<ppc::core::TaskData> task_data,
+                        Distribution distribution = Distribution::kSendLoop)
+      : Task(std::move(task_data)), distribution(distribution) {}
   bool validation() override;
   bool pre_processing() override;
   bool run() override;
   bool post_processing() override;
 
  private:
+  void send_chunks();
+  void scatter_chunks();
+  void pull_chunks();
+
+  Distribution distribution;
   std::vector<int> input, chunk;
+  std::span<const int> local;
   int result{};
   boost::mpi::communicator world;
 };
@@ -182,6 +182,96 @@ TEST(chernykh_a_num_of_alternations_signs_mpi, test_pipeline_run_with_input_size
   }
 }
 
+TEST(chernykh_a_num_of_alternations_signs_mpi, test_pipeline_run_with_input_size_10000000_scatterv) {
+  auto world = boost::mpi::communicator();
+
+  // Create data
+  auto input = std::vector<int>();
+  auto par_output = std::vector<int>(1, 0);
+
+  // Create TaskData
+  auto par_task_data = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    input = std::vector<int>(10'000'000, 0);
+    par_task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+    par_task_data->inputs_count.emplace_back(input.size());
+    par_task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(par_output.data()));
+    par_task_data->outputs_count.emplace_back(par_output.size());
+  }
+
+  // Create Task, distributed with one MPI_Scatterv
+  auto par_task = std::make_shared<chernykh_a_num_of_alternations_signs_mpi::ParallelTask>(
+      par_task_data, chernykh_a_num_of_alternations_signs_mpi::Distribution::kScatterv);
+
+  ASSERT_TRUE(par_task->validation());
+  ASSERT_TRUE(par_task->pre_processing());
+  ASSERT_TRUE(par_task->run());
+  ASSERT_TRUE(par_task->post_processing());
+
+  // Create PerfAttributes
+  auto perf_attributes = std::make_shared<ppc::core::PerfAttr>();
+  perf_attributes->num_running = 10;
+  auto start = boost::mpi::timer();
+  perf_attributes->current_timer = [&] { return start.elapsed(); };
+
+  // Create PerfResults
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(par_task);
+
+  perf_analyzer->pipeline_run(perf_attributes, perf_results);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perf_results);
+    ASSERT_EQ(0, par_output[0]);
+  }
+}
+
+TEST(chernykh_a_num_of_alternations_signs_mpi, test_pipeline_run_with_input_size_10000000_rma_pull) {
+  auto world = boost::mpi::communicator();
+
+  // Create data
+  auto input = std::vector<int>();
+  auto par_output = std::vector<int>(1, 0);
+
+  // Create TaskData
+  auto par_task_data = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    input = std::vector<int>(10'000'000, 0);
+    par_task_data->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+    par_task_data->inputs_count.emplace_back(input.size());
+    par_task_data->outputs.emplace_back(reinterpret_cast<uint8_t *>(par_output.data()));
+    par_task_data->outputs_count.emplace_back(par_output.size());
+  }
+
+  // Create Task, every rank pulls its chunk from a window on the root
+  auto par_task = std::make_shared<chernykh_a_num_of_alternations_signs_mpi::ParallelTask>(
+      par_task_data, chernykh_a_num_of_alternations_signs_mpi::Distribution::kRmaPull);
+
+  ASSERT_TRUE(par_task->validation());
+  ASSERT_TRUE(par_task->pre_processing());
+  ASSERT_TRUE(par_task->run());
+  ASSERT_TRUE(par_task->post_processing());
+
+  // Create PerfAttributes
+  auto perf_attributes = std::make_shared<ppc::core::PerfAttr>();
+  perf_attributes->num_running = 10;
+  auto start = boost::mpi::timer();
+  perf_attributes->current_timer = [&] { return start.elapsed(); };
+
+  // Create PerfResults
+  auto perf_results = std::make_shared<ppc::core::PerfResults>();
+
+  // Create Perf analyzer
+  auto perf_analyzer = std::make_shared<ppc::core::Perf>(par_task);
+
+  perf_analyzer->pipeline_run(perf_attributes, perf_results);
+  if (world.rank() == 0) {
+    ppc::core::Perf::print_perf_statistic(perf_results);
+    ASSERT_EQ(0, par_output[0]);
+  }
+}
+
 TEST(chernykh_a_num_of_alternations_signs_mpi, test_task_run_with_input_size_10000) {
   auto world = boost::mpi::communicator();
 
@@ -1,8 +1,15 @@
 #include "mpi/chernykh_a_num_of_alternations_signs/include/ops_mpi.hpp"
 
+#include <mpi.h>
+
 #include <boost/mpi/collectives.hpp>
+#include <cstdint>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include "mpi_core/rma/include/rma_source.hpp"
+
 bool chernykh_a_num_of_alternations_signs_mpi::SequentialTask::validation() {
   internal_order_test();
   return taskData->inputs_count[0] >= 2 && taskData->outputs_count[0] == 1;
@@ -45,20 +52,16 @@ bool chernykh_a_num_of_alternations_signs_mpi::ParallelTask::validation() {
 bool chernykh_a_num_of_alternations_signs_mpi::ParallelTask::pre_processing() {
   internal_order_test();
 
-  if (world.rank() == 0) {
-    auto input_size = taskData->inputs_count[0];
-    auto chunk_size = input_size / world.size();
-    auto* input_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-    input = std::vector<int>(input_ptr, input_ptr + input_size);
-    chunk = std::vector<int>(input_ptr, input_ptr + chunk_size + uint32_t(world.size() > 1));
-
-    for (int proc = 1; proc < world.size(); proc++) {
-      auto start = proc * chunk_size;
-      auto size = (proc == world.size() - 1) ? input_size - start : chunk_size + 1;
-      world.send(proc, 0, std::vector<int>(input_ptr + start, input_ptr + start + size));
-    }
-  } else {
-    world.recv(0, 0, chunk);
+  switch (distribution) {
+    case Distribution::kSendLoop:
+      send_chunks();
+      break;
+    case Distribution::kScatterv:
+      scatter_chunks();
+      break;
+    case Distribution::kRmaPull:
+      pull_chunks();
+      break;
   }
 
   result = 0;
@@ -68,9 +71,9 @@ bool chernykh_a_num_of_alternations_signs_mpi::ParallelTask::pre_processing() {
 bool chernykh_a_num_of_alternations_signs_mpi::ParallelTask::run() {
   internal_order_test();
   auto chunk_result = 0;
-  auto chunk_size = chunk.size();
-  for (size_t i = 0; i < chunk_size - 1; i++) {
-    if ((chunk[i] ^ chunk[i + 1]) < 0) {
+  auto chunk_size = local.size();
+  for (size_t i = 0; i + 1 < chunk_size; i++) {
+    if ((local[i] ^ local[i + 1]) < 0) {
       chunk_result++;
     }
   }
@@ -85,3 +88,68 @@ bool chernykh_a_num_of_alternations_signs_mpi::ParallelTask::post_processing() {
   }
   return true;
 }
+
+namespace {
+
+// chunks overlap by one element, so sign changes between chunks are counted
+std::pair<std::uint64_t, std::uint64_t> chunk_of(int proc, int size, std::uint64_t input_size) {
+  auto chunk_size = input_size / size;
+  auto start = proc * chunk_size;
+  return {start, (proc == size - 1) ? input_size - start : chunk_size + 1};
+}
+
+}  // namespace
+
+void chernykh_a_num_of_alternations_signs_mpi::ParallelTask::send_chunks() {
+  if (world.rank() == 0) {
+    auto input_size = taskData->inputs_count[0];
+    auto* input_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
+    input = std::vector<int>(input_ptr, input_ptr + input_size);
+    auto [start, size] = chunk_of(0, world.size(), input_size);
+    chunk = std::vector<int>(input_ptr + start, input_ptr + start + size);
+
+    for (int proc = 1; proc < world.size(); proc++) {
+      std::tie(start, size) = chunk_of(proc, world.size(), input_size);
+      world.send(proc, 0, std::vector<int>(input_ptr + start, input_ptr + start + size));
+    }
+  } else {
+    world.recv(0, 0, chunk);
+  }
+  local = chunk;
+}
+
+void chernykh_a_num_of_alternations_signs_mpi::ParallelTask::scatter_chunks() {
+  std::uint64_t input_size = world.rank() == 0 ? taskData->inputs_count[0] : 0;
+  boost::mpi::broadcast(world, input_size, 0);
+  // disjoint blocks, an element of the root may not be sent twice by one scatter
+  auto chunk_size = input_size / world.size();
+  std::vector<int> counts(world.size());
+  std::vector<int> displs(world.size());
+  for (int proc = 0; proc < world.size(); proc++) {
+    auto start = proc * chunk_size;
+    displs[proc] = static_cast<int>(start);
+    counts[proc] = static_cast<int>(proc == world.size() - 1 ? input_size - start : chunk_size);
+  }
+  int count = counts[world.rank()];
+  bool has_next = world.rank() != world.size() - 1 && chunk_size > 0;
+  chunk.resize(count + (has_next ? 1 : 0));
+  const int* input_ptr = world.rank() == 0 ? reinterpret_cast<int*>(taskData->inputs[0]) : nullptr;
+  MPI_Scatterv(input_ptr, counts.data(), displs.data(), MPI_INT, chunk.data(), count, MPI_INT, 0, world);
+
+  // the first element of the next block closes the last sign change of this one
+  if (chunk_size > 0) {
+    int prev = world.rank() == 0 ? MPI_PROC_NULL : world.rank() - 1;
+    int next = has_next ? world.rank() + 1 : MPI_PROC_NULL;
+    MPI_Sendrecv(chunk.data(), 1, MPI_INT, prev, 0, chunk.data() + count, has_next ? 1 : 0, MPI_INT, next, 0, world,
+                 MPI_STATUS_IGNORE);
+  }
+  local = chunk;
+}
+
+void chernykh_a_num_of_alternations_signs_mpi::ParallelTask::pull_chunks() {
+  std::uint64_t input_size = world.rank() == 0 ? taskData->inputs_count[0] : 0;
+  boost::mpi::broadcast(world, input_size, 0);
+  auto [start, size] = chunk_of(world.rank(), world.size(), input_size);
+  const int* input_ptr = world.rank() == 0 ? reinterpret_cast<int*>(taskData->inputs[0]) : nullptr;
+  local = ppc::mpi::pull_view(world, input_ptr, input_size, start, size, chunk);
+}
@@ -7,11 +7,16 @@
 #include <boost/mpi/communicator.hpp>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/hierarchical/include/hierarchical.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace chistov_a_sum_of_matrix_elements {
 template <typename T>
@@ -49,7 +54,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<T> input_;
+  ppc::core::Matrix<T> input_;
   T res{};
 };
 
@@ -64,11 +69,10 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<T> input_, local_input_;
+  std::vector<T> local_storage_;
+  std::span<const T> local_input_;
   T res{};
-  int n{};
-  int m{};
-  boost::mpi::communicator world;
+  ppc::mpi::HierarchicalCommunicator world;
 };
 
 }  // namespace chistov_a_sum_of_matrix_elements
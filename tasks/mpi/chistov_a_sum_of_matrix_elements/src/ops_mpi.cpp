@@ -7,8 +7,8 @@ template <typename T>
 bool TestMPITaskSequential<T>::pre_processing() {
   internal_order_test();
 
-  T* tmp_ptr = reinterpret_cast<T*>(taskData->inputs[0]);
-  input_.assign(tmp_ptr, tmp_ptr + taskData->inputs_count[0]);
+  // the flat input as a 1 x n matrix, without a copy
+  input_ = ppc::core::matrix_from_input<T>(*taskData, 0, 1, taskData->inputs_count[0]);
   return true;
 }
 
@@ -22,7 +22,9 @@ template <typename T>
 bool TestMPITaskSequential<T>::run() {
   internal_order_test();
 
-  res = std::accumulate(input_.begin(), input_.end(), 0);
+  std::vector<T> total;
+  ppc::core::reduce_matrix<ppc::core::SUM>(input_, ppc::core::TOTAL, total);
+  res = total[0];
   return true;
 }
 
@@ -38,33 +40,8 @@ template <typename T>
 bool TestMPITaskParallel<T>::pre_processing() {
   internal_order_test();
 
-  int delta = 0;
-  if (world.rank() == 0) {
-    n = static_cast<int>(taskData->inputs_count[1]);
-    m = static_cast<int>(taskData->inputs_count[2]);
-    delta = (n * m) / world.size();
-  }
-
-  boost::mpi::broadcast(world, delta, 0);
-
-  if (world.rank() == 0) {
-    input_ = std::vector<T>(n * m);
-    auto* tmp_ptr = reinterpret_cast<T*>(taskData->inputs[0]);
-    for (int i = 0; i < static_cast<int>(taskData->inputs_count[0]); i++) {
-      input_[i] = tmp_ptr[i];
-    }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta, delta);
-    }
-  }
-
-  local_input_ = std::vector<T>(delta);
-  if (world.rank() == 0) {
-    local_input_ = std::vector<T>(input_.begin(), input_.begin() + delta);
-  } else {
-    world.recv(0, 0, local_input_.data(), delta);
-  }
-
+  // the root keeps its block in place in the caller's buffer
+  local_input_ = ppc::mpi::scatter_input<T>(world, *taskData, local_storage_);
   return true;
 }
 
@@ -82,7 +59,7 @@ template <typename T>
 bool TestMPITaskParallel<T>::run() {
   internal_order_test();
 
-  T local_res = std::accumulate(local_input_.begin(), local_input_.end(), 0);
+  T local_res = ppc::core::reduce_elements<ppc::core::SUM, T>(local_input_.data(), local_input_.size());
   reduce(world, local_res, res, std::plus<T>(), 0);
 
   return true;
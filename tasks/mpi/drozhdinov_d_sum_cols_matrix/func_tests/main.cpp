@@ -3,9 +3,12 @@
 
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <span>
 #include <vector>
 
 #include "mpi/drozhdinov_d_sum_cols_matrix/include/ops_mpi.hpp"
+#include "mpi_core/distributed_input/include/distributed_input.hpp"
+#include "mpi_core/partition/include/partition.hpp"
 
 TEST(drozhdinov_d_sum_cols_matrix_mpi, EmptyMatrixTest) {
   boost::mpi::communicator world;
@@ -220,6 +223,119 @@ TEST(drozhdinov_d_sum_cols_matrix_mpi, ParallelTest2) {
   }
 }
 
+TEST(drozhdinov_d_sum_cols_matrix_mpi, ParallelDistributedSums) {
+  boost::mpi::communicator world;
+
+  int cols = 37;
+  int rows = 20;
+
+  // Create data
+  std::vector<int> matrix;
+  std::vector<int> ans(cols, 0);
+  if (world.rank() == 0) {
+    matrix.resize(cols * rows);
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < cols; j++) {
+        matrix[i * cols + j] = i + j;
+        ans[j] += i + j;
+      }
+    }
+  }
+
+  // Create TaskData, every rank keeps the sums of its own columns
+  ppc::mpi::BlockPartition columns(cols, world.size());
+  std::vector<int> local_res(columns.count(world.rank()), 0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(matrix.data()));
+    taskDataPar->inputs_count.emplace_back(matrix.size());
+    taskDataPar->inputs_count.emplace_back(cols);
+    taskDataPar->inputs_count.emplace_back(rows);
+  }
+  taskDataPar->output_placement = ppc::core::TaskData::DISTRIBUTED;
+  ppc::mpi::add_distributed_output(*taskDataPar, std::span<int>(local_res), columns.offset(world.rank()), cols);
+
+  drozhdinov_d_sum_cols_matrix_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  auto res = ppc::mpi::gather_output<int>(world, *taskDataPar, 0);
+  if (world.rank() == 0) {
+    ASSERT_EQ(res, ans);
+  }
+}
+
+TEST(drozhdinov_d_sum_cols_matrix_mpi, ParallelDistributedSumsRejectOtherSplit) {
+  boost::mpi::communicator world;
+
+  int cols = 37;
+  int rows = 20;
+  std::vector<int> matrix;
+  if (world.rank() == 0) {
+    matrix.assign(cols * rows, 1);
+  }
+
+  // every block is one element longer than the one reduce_result writes
+  ppc::mpi::BlockPartition columns(cols, world.size());
+  std::vector<int> local_res(columns.count(world.rank()) + 1, 0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(matrix.data()));
+    taskDataPar->inputs_count.emplace_back(matrix.size());
+    taskDataPar->inputs_count.emplace_back(cols);
+    taskDataPar->inputs_count.emplace_back(rows);
+  }
+  taskDataPar->output_placement = ppc::core::TaskData::DISTRIBUTED;
+  ppc::mpi::add_distributed_output(*taskDataPar, std::span<int>(local_res), columns.offset(world.rank()), cols);
+
+  drozhdinov_d_sum_cols_matrix_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+  ASSERT_EQ(testMpiTaskParallel.validation(), false);
+}
+
+TEST(drozhdinov_d_sum_cols_matrix_mpi, ParallelAllRanksSums) {
+  boost::mpi::communicator world;
+
+  int cols = 23;
+  int rows = 9;
+  std::vector<int> matrix;
+  std::vector<int> ans(cols, 0);
+  for (int i = 0; i < rows; i++) {
+    for (int j = 0; j < cols; j++) {
+      ans[j] += i - j;
+    }
+  }
+  if (world.rank() == 0) {
+    matrix.resize(cols * rows);
+    for (int i = 0; i < rows; i++) {
+      for (int j = 0; j < cols; j++) {
+        matrix[i * cols + j] = i - j;
+      }
+    }
+  }
+
+  // every rank gets all sums; only the root knows the size of the matrix
+  std::vector<int> res(cols, 0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(matrix.data()));
+    taskDataPar->inputs_count.emplace_back(matrix.size());
+    taskDataPar->inputs_count.emplace_back(cols);
+    taskDataPar->inputs_count.emplace_back(rows);
+  }
+  taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(res.data()));
+  taskDataPar->outputs_count.emplace_back(res.size());
+  taskDataPar->output_placement = ppc::core::TaskData::ALL_RANKS;
+
+  drozhdinov_d_sum_cols_matrix_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+  ASSERT_EQ(res, ans);
+}
+
 TEST(drozhdinov_d_sum_cols_matrix_mpi, ParallelTest3) {
   boost::mpi::communicator world;
 
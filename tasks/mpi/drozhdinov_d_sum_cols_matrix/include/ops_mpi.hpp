@@ -7,17 +7,22 @@
 #include <boost/mpi/communicator.hpp>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/matrix_reduction/include/matrix_reduction.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace drozhdinov_d_sum_cols_matrix_mpi {
 
 std::vector<int> getRandomVector(int sz);
 int makeLinCoords(int x, int y, int xSize);
-std::vector<int> calcMatSumSeq(const std::vector<int>& matrix, int xSize, int ySize, int fromX, int toX);
+std::vector<int> calcMatSumSeq(std::span<const int> matrix, int xSize, int ySize, int fromX, int toX);
 class TestMPITaskSequential : public ppc::core::Task {
  public:
   explicit TestMPITaskSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
@@ -42,10 +47,11 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  ppc::core::Matrix<int> input_;
+  // whole rows of the rank
+  std::vector<int> storage_;
+  ppc::core::Matrix<const int> local_;
   std::vector<int> res;
-  int cols{};
-  int rows{};
   boost::mpi::communicator world;
 };
 
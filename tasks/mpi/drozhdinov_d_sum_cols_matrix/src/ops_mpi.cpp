@@ -3,11 +3,16 @@
 
 #include <algorithm>
 #include <functional>
+#include <numeric>
 #include <random>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "core/simd/include/column_sums.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/result_placement/include/result_placement.hpp"
+
 using namespace std::chrono_literals;
 
 std::vector<int> drozhdinov_d_sum_cols_matrix_mpi::getRandomVector(int sz) {
@@ -22,17 +27,11 @@ std::vector<int> drozhdinov_d_sum_cols_matrix_mpi::getRandomVector(int sz) {
 
 int drozhdinov_d_sum_cols_matrix_mpi::makeLinCoords(int x, int y, int xSize) { return y * xSize + x; }
 
-std::vector<int> drozhdinov_d_sum_cols_matrix_mpi::calcMatSumSeq(const std::vector<int>& matrix, int xSize, int ySize,
+std::vector<int> drozhdinov_d_sum_cols_matrix_mpi::calcMatSumSeq(std::span<const int> matrix, int xSize, int ySize,
                                                                  int fromX, int toX) {
-  std::vector<int> result;
-  for (int x = fromX; x < toX; x++) {
-    int columnSum = 0;
-    for (int y = 0; y < ySize; y++) {
-      int linearizedCoordinate = makeLinCoords(x, y, xSize);
-      columnSum += matrix[linearizedCoordinate];
-    }
-    result.push_back(columnSum);
-  }
+  // rows are streamed in memory order instead of walking down every column
+  std::vector<int> result(toX - fromX, 0);
+  ppc::core::add_column_sums(matrix.data() + fromX, ySize, result.size(), xSize, result.data());
   return result;
 }
 
@@ -73,62 +72,53 @@ bool drozhdinov_d_sum_cols_matrix_mpi::TestMPITaskSequential::post_processing()
 bool drozhdinov_d_sum_cols_matrix_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
   if (world.rank() == 0) {
-    rows = taskData->inputs_count[2];
-    cols = taskData->inputs_count[1];
-  }
-  broadcast(world, cols, 0);
-  broadcast(world, rows, 0);
-  // fbd nt ncssr dlt
-  if (world.rank() == 0) {
-    // Init vectors
-    input_ = std::vector<int>(taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-    for (unsigned int i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
-  } else {
-    input_ = std::vector<int>(cols * rows);
+    input_ = ppc::core::matrix_from_input<int>(*taskData, 0, taskData->inputs_count[2], taskData->inputs_count[1]);
   }
-  broadcast(world, input_.data(), cols * rows, 0);
-  // Init value for output
-  res = std::vector<int>(cols, 0);
+  // every rank gets a block of whole rows, contiguous in the matrix
+  local_ = ppc::mpi::scatter_rows(world, input_, storage_);
   return true;
 }
 
 bool drozhdinov_d_sum_cols_matrix_mpi::TestMPITaskParallel::validation() {
   internal_order_test();
-  if (world.rank() == 0) {
+  // the number of columns is known on the root, ranks that get all sums need it too
+  std::uint64_t columns = world.rank() == 0 ? taskData->inputs_count[1] : 0;
+  if (taskData->output_placement == ppc::core::TaskData::ALL_RANKS) {
+    boost::mpi::broadcast(world, columns, 0);
+  }
+  if (taskData->output_placement == ppc::core::TaskData::DISTRIBUTED) {
+    // every rank gets the sums of its block of columns, split as reduce_result splits them
+    if (taskData->outputs.empty() || taskData->outputs_offset.empty() || taskData->outputs_global_count.empty()) {
+      return false;
+    }
+    std::uint64_t global_count = taskData->outputs_global_count[0];
+    ppc::mpi::BlockPartition blocks(static_cast<int>(global_count), world.size());
+    return (world.rank() != 0 || global_count == columns) &&
+           taskData->outputs_count[0] == static_cast<std::uint64_t>(blocks.count(world.rank())) &&
+           taskData->outputs_offset[0] == static_cast<std::uint64_t>(blocks.offset(world.rank()));
+  }
+  // outputs are needed only where the result is placed
+  if (ppc::mpi::holds_result(world, *taskData)) {
     // Check count elements of output
-    return taskData->outputs_count[0] == taskData->inputs_count[1];
+    return !taskData->outputs.empty() && taskData->outputs_count[0] == columns;
   }
   return true;
 }
 
 bool drozhdinov_d_sum_cols_matrix_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  int delta = cols / world.size();
-  delta += (cols % world.size() == 0) ? 0 : 1;
-  int lastCol = std::min(cols, delta * (world.rank() + 1));
-  auto localSum = calcMatSumSeq(input_, cols, rows, delta * world.rank(), lastCol);
-  localSum.resize(delta);
-  if (world.rank() == 0) {
-    std::vector<int> localRes(cols + delta * world.size());
-    std::vector<int> sizes(world.size(), delta);
-    boost::mpi::gatherv(world, localSum.data(), localSum.size(), localRes.data(), sizes, 0);
-    localRes.resize(cols);
-    res = localRes;
-  } else {
-    boost::mpi::gatherv(world, localSum.data(), localSum.size(), 0);
-  }
+  // column sums of the own rows, then one vector reduction of all of them
+  std::vector<int> localSum;
+  ppc::core::reduce_matrix<ppc::core::SUM>(local_, ppc::core::BY_COLUMN, localSum);
+  ppc::mpi::combine_partials<ppc::core::SUM>(world, *taskData, ppc::core::BY_COLUMN, localSum, res);
   return true;
 }
 
 bool drozhdinov_d_sum_cols_matrix_mpi::TestMPITaskParallel::post_processing() {
   internal_order_test();
-  if (world.rank() == 0) {
-    for (int i = 0; i < cols; i++) {
-      reinterpret_cast<int*>(taskData->outputs[0])[i] = res[i];
-    }
+  // res is empty on ranks that don't get the result
+  for (size_t i = 0; i < res.size(); i++) {
+    reinterpret_cast<int*>(taskData->outputs[0])[i] = res[i];
   }
   return true;
 }
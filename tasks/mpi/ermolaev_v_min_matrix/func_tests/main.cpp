@@ -222,3 +222,42 @@ TEST(ermolaev_v_min_matrix_mpi, Test_Min_100x100) {
     ASSERT_EQ(reference_min[0], global_min[0]);
   }
 }
+
+TEST(ermolaev_v_min_matrix_mpi, Test_Min_Position_13x7) {
+  const int count_rows = 13;
+  const int count_columns = 7;
+
+  boost::mpi::communicator world;
+  std::vector<std::vector<int>> global_matrix;
+  std::vector<int32_t> global_min(1, INT_MAX);
+  std::vector<uint64_t> global_index(1, 0);
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    global_matrix = ermolaev_v_min_matrix_mpi::getRandomMatrix(count_rows, count_columns, 0, 500);
+    // the same minimum in the last row and in an earlier one
+    global_matrix[12][6] = -7;
+    global_matrix[9][3] = -7;
+    for (unsigned int i = 0; i < global_matrix.size(); i++)
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_matrix[i].data()));
+    taskDataPar->inputs_count.emplace_back(count_rows);
+    taskDataPar->inputs_count.emplace_back(count_columns);
+
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_min.data()));
+    taskDataPar->outputs_count.emplace_back(global_min.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_index.data()));
+    taskDataPar->outputs_count.emplace_back(global_index.size());
+  }
+
+  ermolaev_v_min_matrix_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    ASSERT_EQ(-7, global_min[0]);
+    ASSERT_EQ(static_cast<uint64_t>((9 * count_columns) + 3), global_index[0]);
+  }
+}
@@ -5,13 +5,18 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/matrix_reduction/include/matrix_reduction.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace ermolaev_v_min_matrix_mpi {
 
@@ -27,8 +32,10 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<int>> input_;
+  ppc::core::Matrix<int> input_;
   int res_{};
+  // row-major position i * columns + j of the minimum
+  std::uint64_t res_index_{};
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -40,8 +47,12 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_, local_input_;
-  int res_{};
+  ppc::core::Matrix<int> input_;
+  std::vector<int> storage_;
+  ppc::core::Matrix<const int> local_input_;
+  // position of the first local element in the whole matrix
+  std::uint64_t offset_{};
+  ppc::core::Extremum<int> res_{};
   boost::mpi::communicator world;
 };
 
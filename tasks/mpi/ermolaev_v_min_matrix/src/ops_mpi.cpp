@@ -30,12 +30,7 @@ std::vector<std::vector<int>> ermolaev_v_min_matrix_mpi::getRandomMatrix(int row
 bool ermolaev_v_min_matrix_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
   // Init vectors
-  input_ = std::vector<std::vector<int>>(taskData->inputs_count[0], std::vector<int>(taskData->inputs_count[1]));
-
-  for (unsigned int i = 0; i < taskData->inputs_count[0]; i++) {
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[i]);
-    std::copy(tmp_ptr, tmp_ptr + taskData->inputs_count[1], input_[i].begin());
-  }
+  input_ = ppc::core::matrix_from_rows<int>(*taskData, taskData->inputs_count[0], taskData->inputs_count[1]);
 
   // Init value for output
   res_ = INT_MAX;
@@ -44,73 +39,46 @@ bool ermolaev_v_min_matrix_mpi::TestMPITaskSequential::pre_processing() {
 
 bool ermolaev_v_min_matrix_mpi::TestMPITaskSequential::validation() {
   internal_order_test();
-  // Check count elements of output
-  return taskData->outputs_count[0] == 1 && taskData->inputs_count[0] > 0 && taskData->inputs_count[1] > 0;
+  // Check count elements of output, the position of the minimum is optional
+  return taskData->outputs_count[0] == 1 && taskData->inputs_count[0] > 0 && taskData->inputs_count[1] > 0 &&
+         (taskData->outputs_count.size() < 2 || taskData->outputs_count[1] == 1);
 }
 
 bool ermolaev_v_min_matrix_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  std::vector<int> local_res(input_.size());
-
-  for (unsigned int i = 0; i < input_.size(); i++) {
-    local_res[i] = *std::min_element(input_[i].begin(), input_[i].end());
-  }
-
-  res_ = *std::min_element(local_res.begin(), local_res.end());
+  auto min = ppc::core::arg_reduce_matrix<ppc::core::MIN>(input_);
+  res_ = min.value;
+  res_index_ = min.index;
   return true;
 }
 
 bool ermolaev_v_min_matrix_mpi::TestMPITaskSequential::post_processing() {
   internal_order_test();
   reinterpret_cast<int*>(taskData->outputs[0])[0] = res_;
+  if (taskData->outputs.size() > 1) {
+    reinterpret_cast<std::uint64_t*>(taskData->outputs[1])[0] = res_index_;
+  }
   return true;
 }
 
 bool ermolaev_v_min_matrix_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
 
-  unsigned int delta = 0;
   if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] * taskData->inputs_count[1] / world.size();
+    input_ = ppc::core::matrix_from_rows<int>(*taskData, taskData->inputs_count[0], taskData->inputs_count[1]);
   }
-  broadcast(world, delta, 0);
-
-  if (world.rank() == 0) {
-    // Init vectors
-
-    unsigned int rows = taskData->inputs_count[0];
-    unsigned int columns = taskData->inputs_count[1];
-    input_ = std::vector<int>(rows * columns);
-
-    for (unsigned int i = 0; i < rows; i++) {
-      auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[i]);
-      for (unsigned int j = 0; j < columns; j++) {
-        input_[i * columns + j] = tmp_ptr[j];
-      }
-    }
-
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + delta * proc, delta);
-    }
-  }
-
-  local_input_ = std::vector<int>(delta);
-  if (world.rank() == 0) {
-    local_input_ = std::vector<int>(input_.begin(), input_.begin() + delta);
-  } else {
-    world.recv(0, 0, local_input_.data(), delta);
-  }
-
-  // Init value for output
-  res_ = INT_MAX;
+  // blocks of whole rows, so every element is some rank's
+  local_input_ = ppc::mpi::scatter_rows(world, input_, storage_);
+  offset_ = ppc::mpi::block_offset(world, local_input_.rows()) * local_input_.cols();
   return true;
 }
 
 bool ermolaev_v_min_matrix_mpi::TestMPITaskParallel::validation() {
   internal_order_test();
   if (world.rank() == 0) {
-    // Check count elements of output
-    return taskData->outputs_count[0] == 1 && !taskData->inputs.empty();
+    // Check count elements of output, the position of the minimum is optional
+    return taskData->outputs_count[0] == 1 && !taskData->inputs.empty() &&
+           (taskData->outputs_count.size() < 2 || taskData->outputs_count[1] == 1);
   }
   return true;
 }
@@ -118,8 +86,9 @@ bool ermolaev_v_min_matrix_mpi::TestMPITaskParallel::validation() {
 bool ermolaev_v_min_matrix_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  int local_res = *std::min_element(local_input_.begin(), local_input_.end());
-  reduce(world, local_res, res_, boost::mpi::minimum<int>(), 0);
+  // MINLOC over the ranks with positions in the whole matrix
+  res_ = ppc::mpi::combine_extrema<ppc::core::MIN>(
+      world, *taskData, ppc::core::arg_reduce_matrix<ppc::core::MIN>(local_input_, offset_));
 
   return true;
 }
@@ -127,7 +96,10 @@ bool ermolaev_v_min_matrix_mpi::TestMPITaskParallel::run() {
 bool ermolaev_v_min_matrix_mpi::TestMPITaskParallel::post_processing() {
   internal_order_test();
   if (world.rank() == 0) {
-    reinterpret_cast<int*>(taskData->outputs[0])[0] = res_;
+    reinterpret_cast<int*>(taskData->outputs[0])[0] = res_.value;
+    if (taskData->outputs.size() > 1) {
+      reinterpret_cast<std::uint64_t*>(taskData->outputs[1])[0] = res_.index;
+    }
   }
   return true;
 }
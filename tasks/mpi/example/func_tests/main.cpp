@@ -3,9 +3,12 @@
 
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <numeric>
 #include <vector>
 
+#include "core/generator/include/generator.hpp"
 #include "mpi/example/include/ops_mpi.hpp"
+#include "mpi_core/distributed_input/include/distributed_input.hpp"
 
 TEST(Parallel_Operations_MPI, Test_Sum) {
   boost::mpi::communicator world;
@@ -227,6 +230,72 @@ TEST(Parallel_Operations_MPI, Test_Max_2) {
   }
 }
 
+TEST(Parallel_Operations_MPI, Test_Sum_Distributed_Input) {
+  boost::mpi::communicator world;
+  std::vector<int> local_vec;
+  std::vector<int32_t> global_sum(1, 0);
+  const int count_size_vector = 125;
+  const ppc::core::CounterGenerator<int> gen(7, -100, 100);
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  ppc::mpi::add_distributed_input(world, *taskDataPar, local_vec, count_size_vector, gen);
+  if (world.rank() == 0) {
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_sum.data()));
+    taskDataPar->outputs_count.emplace_back(global_sum.size());
+  }
+
+  nesterov_a_test_task_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar, "+");
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  if (world.rank() == 0) {
+    // Create data
+    auto global_vec = gen.generate(0, count_size_vector);
+    std::vector<int32_t> reference_sum(1, 0);
+
+    // Create TaskData
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
+    taskDataSeq->inputs_count.emplace_back(global_vec.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(reference_sum.data()));
+    taskDataSeq->outputs_count.emplace_back(reference_sum.size());
+
+    // Create Task
+    nesterov_a_test_task_mpi::TestMPITaskSequential testMpiTaskSequential(taskDataSeq, "+");
+    ASSERT_EQ(testMpiTaskSequential.validation(), true);
+    testMpiTaskSequential.pre_processing();
+    testMpiTaskSequential.run();
+    testMpiTaskSequential.post_processing();
+
+    ASSERT_EQ(reference_sum[0], global_sum[0]);
+  }
+}
+
+TEST(Parallel_Operations_MPI, Test_Sum_On_All_Ranks) {
+  boost::mpi::communicator world;
+  std::vector<int> local_vec;
+  std::vector<int32_t> global_sum(1, 0);
+  const int count_size_vector = 90;
+  const ppc::core::CounterGenerator<int> gen(11, -100, 100);
+  // Create TaskData, every rank gets the result
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  ppc::mpi::add_distributed_input(world, *taskDataPar, local_vec, count_size_vector, gen);
+  taskDataPar->output_placement = ppc::core::TaskData::ALL_RANKS;
+  taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_sum.data()));
+  taskDataPar->outputs_count.emplace_back(global_sum.size());
+
+  nesterov_a_test_task_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar, "+");
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+
+  auto global_vec = gen.generate(0, count_size_vector);
+  ASSERT_EQ(std::accumulate(global_vec.begin(), global_vec.end(), 0), global_sum[0]);
+}
+
 int main(int argc, char** argv) {
   boost::mpi::environment env(argc, argv);
   boost::mpi::communicator world;
@@ -7,11 +7,17 @@
 #include <boost/mpi/communicator.hpp>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "core/task/include/task.hpp"
+#include "mpi_core/distributed_input/include/distributed_input.hpp"
+#include "mpi_core/hierarchical/include/hierarchical.hpp"
+#include "mpi_core/persistent/include/persistent_scatter.hpp"
+#include "mpi_core/persistent/include/plan_cache.hpp"
+#include "mpi_core/result_placement/include/result_placement.hpp"
 
 namespace nesterov_a_test_task_mpi {
 
@@ -42,10 +48,11 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_, local_input_;
+  std::span<const int> local_input_;
   int res{};
   std::string ops;
-  boost::mpi::communicator world;
+  ppc::mpi::HierarchicalCommunicator world;
+  ppc::mpi::PlanCache<ppc::mpi::PersistentScatter<int>> scatter_plan_;
 };
 
 }  // namespace nesterov_a_test_task_mpi
\ No newline at end of file
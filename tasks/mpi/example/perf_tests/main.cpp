@@ -2,23 +2,24 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/timer.hpp>
+#include <numeric>
 #include <vector>
 
+#include "core/generator/include/generator.hpp"
 #include "core/perf/include/perf.hpp"
 #include "mpi/example/include/ops_mpi.hpp"
+#include "mpi_core/distributed_input/include/distributed_input.hpp"
 
 TEST(mpi_example_perf_test, test_pipeline_run) {
   boost::mpi::communicator world;
-  std::vector<int> global_vec;
+  std::vector<int> local_vec;
   std::vector<int32_t> global_sum(1, 0);
-  // Create TaskData
+  const int count_size_vector = 120;
+  // Every rank generates only its own block of the input
+  const ppc::core::CounterGenerator<int> gen(2024, 0, 99);
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
-  int count_size_vector;
+  ppc::mpi::add_distributed_input(world, *taskDataPar, local_vec, count_size_vector, gen);
   if (world.rank() == 0) {
-    count_size_vector = 120;
-    global_vec = std::vector<int>(count_size_vector, 1);
-    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
-    taskDataPar->inputs_count.emplace_back(global_vec.size());
     taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_sum.data()));
     taskDataPar->outputs_count.emplace_back(global_sum.size());
   }
@@ -43,22 +44,21 @@ TEST(mpi_example_perf_test, test_pipeline_run) {
   perfAnalyzer->pipeline_run(perfAttr, perfResults);
   if (world.rank() == 0) {
     ppc::core::Perf::print_perf_statistic(perfResults);
-    ASSERT_EQ(count_size_vector, global_sum[0]);
+    auto global_vec = gen.generate(0, count_size_vector);
+    ASSERT_EQ(std::accumulate(global_vec.begin(), global_vec.end(), 0), global_sum[0]);
   }
 }
 
 TEST(mpi_example_perf_test, test_task_run) {
   boost::mpi::communicator world;
-  std::vector<int> global_vec;
+  std::vector<int> local_vec;
   std::vector<int32_t> global_sum(1, 0);
-  // Create TaskData
+  const int count_size_vector = 120;
+  // Every rank generates only its own block of the input
+  const ppc::core::CounterGenerator<int> gen(2024, 0, 99);
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
-  int count_size_vector;
+  ppc::mpi::add_distributed_input(world, *taskDataPar, local_vec, count_size_vector, gen);
   if (world.rank() == 0) {
-    count_size_vector = 120;
-    global_vec = std::vector<int>(count_size_vector, 1);
-    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
-    taskDataPar->inputs_count.emplace_back(global_vec.size());
     taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_sum.data()));
     taskDataPar->outputs_count.emplace_back(global_sum.size());
   }
@@ -83,7 +83,8 @@ TEST(mpi_example_perf_test, test_task_run) {
   perfAnalyzer->task_run(perfAttr, perfResults);
   if (world.rank() == 0) {
     ppc::core::Perf::print_perf_statistic(perfResults);
-    ASSERT_EQ(count_size_vector, global_sum[0]);
+    auto global_vec = gen.generate(0, count_size_vector);
+    ASSERT_EQ(std::accumulate(global_vec.begin(), global_vec.end(), 0), global_sum[0]);
   }
 }
 
@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <functional>
+#include <limits>
 #include <random>
 #include <string>
 #include <thread>
@@ -59,29 +60,28 @@ bool nesterov_a_test_task_mpi::TestMPITaskSequential::post_processing() {
 
 bool nesterov_a_test_task_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
+  if (taskData->distributed) {
+    // every rank already holds its own block
+    local_input_ = ppc::mpi::input_block<int>(*taskData, 0).local;
+    res = 0;
+    return true;
   }
-  broadcast(world, delta, 0);
 
-  if (world.rank() == 0) {
-    // Init vectors
-    input_ = std::vector<int>(taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
+  // sizes are sent and the scatter is set up only when the plan can't be reused
+  auto& scatter = scatter_plan_.get(taskData, world, [&] {
+    int count = 0;
+    const int* data = nullptr;
+    if (world.rank() == 0) {
+      count = static_cast<int>(taskData->inputs_count[0]);
+      data = reinterpret_cast<int*>(taskData->inputs[0]);
     }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta, delta);
-    }
-  }
-  local_input_ = std::vector<int>(delta);
-  if (world.rank() == 0) {
-    local_input_ = std::vector<int>(input_.begin(), input_.begin() + delta);
-  } else {
-    world.recv(0, 0, local_input_.data(), delta);
-  }
+    broadcast(world, count, 0);
+    return std::make_unique<ppc::mpi::PersistentScatter<int>>(world, data,
+                                                              ppc::mpi::BlockPartition(count, world.size()));
+  });
+  scatter.start();
+  scatter.wait();
+  local_input_ = scatter.local();
   // Init value for output
   res = 0;
   return true;
@@ -89,7 +89,8 @@ bool nesterov_a_test_task_mpi::TestMPITaskParallel::pre_processing() {
 
 bool nesterov_a_test_task_mpi::TestMPITaskParallel::validation() {
   internal_order_test();
-  if (world.rank() == 0) {
+  // outputs are needed only where the result is placed
+  if (ppc::mpi::holds_result(world, *taskData)) {
     // Check count elements of output
     return taskData->outputs_count[0] == 1;
   }
@@ -98,26 +99,27 @@ bool nesterov_a_test_task_mpi::TestMPITaskParallel::validation() {
 
 bool nesterov_a_test_task_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  int local_res;
+  int local_res = 0;
   if (ops == "+") {
     local_res = std::accumulate(local_input_.begin(), local_input_.end(), 0);
   } else if (ops == "-") {
     local_res = -std::accumulate(local_input_.begin(), local_input_.end(), 0);
   } else if (ops == "max") {
-    local_res = *std::max_element(local_input_.begin(), local_input_.end());
+    local_res = local_input_.empty() ? std::numeric_limits<int>::min()
+                                     : *std::max_element(local_input_.begin(), local_input_.end());
   }
 
   if (ops == "+" || ops == "-") {
-    reduce(world, local_res, res, std::plus(), 0);
+    ppc::mpi::reduce_result(world, *taskData, local_res, res, std::plus<int>());
   } else if (ops == "max") {
-    reduce(world, local_res, res, boost::mpi::maximum<int>(), 0);
+    ppc::mpi::reduce_result(world, *taskData, local_res, res, boost::mpi::maximum<int>());
   }
   return true;
 }
 
 bool nesterov_a_test_task_mpi::TestMPITaskParallel::post_processing() {
   internal_order_test();
-  if (world.rank() == 0) {
+  if (ppc::mpi::holds_result(world, *taskData)) {
     reinterpret_cast<int*>(taskData->outputs[0])[0] = res;
   }
   return true;
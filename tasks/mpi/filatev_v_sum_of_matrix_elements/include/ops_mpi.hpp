@@ -11,7 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/matrix_reduction/include/matrix_reduction.hpp"
 
 namespace filatev_v_sum_of_matrix_elements_mpi {
 
@@ -24,7 +26,7 @@ class SumMatrixSeq : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> matrix;
+  ppc::core::Matrix<int> matrix;
   long long summ = 0;
   int size_n, size_m;
 };
@@ -39,9 +41,8 @@ class SumMatrixParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> matrix;
+  ppc::core::Matrix<int> matrix;
   long long summ = 0;
-  std::vector<int> local_vector;
   int size_n, size_m;
   boost::mpi::communicator world;
 };
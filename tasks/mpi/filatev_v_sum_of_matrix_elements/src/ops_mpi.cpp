@@ -12,12 +12,7 @@ bool filatev_v_sum_of_matrix_elements_mpi::SumMatrixSeq::pre_processing() {
   summ = 0;
   size_n = taskData->inputs_count[0];
   size_m = taskData->inputs_count[1];
-
-  for (int i = 0; i < size_m; ++i) {
-    auto* temp = reinterpret_cast<int*>(taskData->inputs[i]);
-
-    matrix.insert(matrix.end(), temp, temp + size_n);
-  }
+  matrix = ppc::core::matrix_from_rows<int>(*taskData, size_m, size_n);
 
   return true;
 }
@@ -31,7 +26,9 @@ bool filatev_v_sum_of_matrix_elements_mpi::SumMatrixSeq::validation() {
 bool filatev_v_sum_of_matrix_elements_mpi::SumMatrixSeq::run() {
   internal_order_test();
 
-  summ = std::accumulate(matrix.begin(), matrix.end(), 0);
+  std::vector<long long> total;
+  ppc::core::reduce_matrix<ppc::core::SUM>(matrix, ppc::core::TOTAL, total);
+  summ = total[0];
 
   return true;
 }
@@ -48,12 +45,7 @@ bool filatev_v_sum_of_matrix_elements_mpi::SumMatrixParallel::pre_processing() {
   if (world.rank() == 0) {
     size_n = taskData->inputs_count[0];
     size_m = taskData->inputs_count[1];
-
-    for (int i = 0; i < size_m; ++i) {
-      auto* temp = reinterpret_cast<int*>(taskData->inputs[i]);
-
-      matrix.insert(matrix.end(), temp, temp + size_n);
-    }
+    matrix = ppc::core::matrix_from_rows<int>(*taskData, size_m, size_n);
   }
   summ = 0;
   return true;
@@ -70,28 +62,11 @@ bool filatev_v_sum_of_matrix_elements_mpi::SumMatrixParallel::validation() {
 
 bool filatev_v_sum_of_matrix_elements_mpi::SumMatrixParallel::run() {
   internal_order_test();
-  int delta = 0;
-  int ras = 0;
-
-  if (world.rank() == 0 && world.size() > 1) {
-    ras = (size_n * size_m) % (world.size() - 1);
-    delta = (size_n * size_m) / (world.size() - 1);
-  } else if (world.rank() == 0 && world.size() == 1) {
-    ras = (size_n * size_m);
-  }
-  broadcast(world, delta, 0);
-
-  if (world.rank() == 0) {
-    for (int proc = 0; proc < (world.size() - 1); proc++) {
-      world.send(proc + 1, 0, matrix.data() + proc * delta + ras, delta);
-    }
-    local_vector = std::vector<int>(matrix.begin(), matrix.begin() + ras);
-  } else {
-    local_vector = std::vector<int>(delta);
-    world.recv(0, 0, local_vector.data(), delta);
-  }
-  long long local_summ = std::accumulate(local_vector.begin(), local_vector.end(), 0);
-  reduce(world, local_summ, summ, std::plus(), 0);
+  // blocks of whole rows scattered from the root's matrix, summed in
+  // long long on every rank
+  std::vector<long long> total;
+  ppc::mpi::reduce_matrix<ppc::core::SUM, long long>(world, *taskData, matrix, ppc::core::TOTAL, total);
+  summ = total[0];
   return true;
 }
 
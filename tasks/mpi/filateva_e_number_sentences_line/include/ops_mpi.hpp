@@ -11,7 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/simd/include/text_scan.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/text_scan/include/text_scan.hpp"
 
 namespace filateva_e_number_sentences_line_mpi {
 
@@ -40,7 +42,6 @@ class NumberSentencesLineParallel : public ppc::core::Task {
 
  private:
   std::string line;
-  std::string local_line;
   int sentence_count;
   boost::mpi::communicator world;
 };
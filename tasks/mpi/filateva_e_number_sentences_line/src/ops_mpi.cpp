@@ -7,13 +7,7 @@
 #include <vector>
 
 int filateva_e_number_sentences_line_mpi::countSentences(std::string line) {
-  int count = 0;
-  for (long unsigned int i = 0; i < line.size(); ++i) {
-    if (line[i] == '.' || line[i] == '?' || line[i] == '!') {
-      ++count;
-    }
-  }
-  return count;
+  return static_cast<int>(ppc::core::scan_text(line.data(), line.size()).terminators);
 }
 
 bool filateva_e_number_sentences_line_mpi::NumberSentencesLineSequential::pre_processing() {
@@ -66,32 +60,12 @@ bool filateva_e_number_sentences_line_mpi::NumberSentencesLineParallel::validati
 
 bool filateva_e_number_sentences_line_mpi::NumberSentencesLineParallel::run() {
   internal_order_test();
-  unsigned int delta = 0;
-  unsigned int remains = 0;
-  int local_sentence_count;
-  if (world.rank() == 0 && world.size() > 1) {
-    delta = line.size() / (world.size() - 1);
-    remains = line.size() % (world.size() - 1);
-  } else if (world.rank() == 0 && world.size() == 1) {
-    remains = line.size();
-  }
-  broadcast(world, delta, 0);
-
-  if (world.rank() == 0) {
-    for (int proc = 0; proc < (world.size() - 1); proc++) {
-      world.send(proc + 1, 0, line.data() + proc * delta + remains, delta);
-    }
-    local_line = std::string(line.begin(), line.begin() + remains);
-  } else {
-    local_line = std::string(delta, '*');
-    world.recv(0, 0, local_line.data(), delta);
-  }
-
-  local_sentence_count = countSentences(local_line);
-  if (world.rank() == 0 && !line.empty() && line.back() != '.' && line.back() != '?' && line.back() != '!') {
-    ++local_sentence_count;
+  // the line is scattered from the root, the counts of the blocks are combined on it
+  auto counts = ppc::mpi::scan_text(world, *taskData, line.data(), line.size());
+  sentence_count = static_cast<int>(counts.terminators);
+  if (world.rank() == 0 && counts.bytes > 0 && (counts.last & ppc::core::TERMINATOR) == 0) {
+    ++sentence_count;
   }
-  reduce(world, local_sentence_count, sentence_count, std::plus(), 0);
   return true;
 }
 
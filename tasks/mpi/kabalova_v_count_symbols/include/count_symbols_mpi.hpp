@@ -11,7 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/simd/include/text_scan.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/text_scan/include/text_scan.hpp"
 
 namespace kabalova_v_count_symbols_mpi {
 
@@ -41,7 +43,7 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::string input_{}, local_input_{};
+  std::string input_{};
   int result{};
   boost::mpi::communicator world;
 };
@@ -27,13 +27,7 @@ std::string kabalova_v_count_symbols_mpi::getRandomString() {
 }
 
 int kabalova_v_count_symbols_mpi::countSymbols(std::string& str) {
-  int result = 0;
-  for (size_t i = 0; i < str.size(); i++) {
-    if (isalpha(str[i]) != 0) {
-      result++;
-    }
-  }
-  return result;
+  return static_cast<int>(ppc::core::scan_text(str.data(), str.size()).letters);
 }
 
 bool kabalova_v_count_symbols_mpi::TestMPITaskSequential::pre_processing() {
@@ -70,39 +64,9 @@ bool kabalova_v_count_symbols_mpi::TestMPITaskSequential::post_processing() {
 
 bool kabalova_v_count_symbols_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  if (world.rank() == 0) {
-    // Get delta = string.size() / num_threads
-    delta = taskData->inputs_count[0] % world.size() == 0 ? taskData->inputs_count[0] / world.size()
-                                                          : taskData->inputs_count[0] / world.size() + 1;
-  }
-  broadcast(world, delta, 0);
-  // Initialize main string in root
-  // Then send substrings to processes
+  // Initialize main string in root, the substrings are sent in run
   if (world.rank() == 0) {
     input_ = std::string(reinterpret_cast<char*>(taskData->inputs[0]), taskData->inputs_count[0]);
-    for (int proc = 1; proc < world.size(); proc++) {
-      // input_size() / world.size() not always an integer
-      // so the last process sometimes gets memory access violation
-      // calculate this "delta" between input_.size() and proc * delta
-      // also if number of processes larger than world.size() then bufdelta is zero and they other processes get empty
-      // string
-      int bufDelta = 0;
-      if ((size_t)(proc * delta + delta) > input_.size() && (size_t)proc < input_.size()) {
-        bufDelta = input_.size() - proc * delta - delta;
-      }
-      world.send(proc, 0, input_.data() + proc * delta, delta + bufDelta);
-    }
-  }
-  // Initialize substring in root
-  if (world.rank() == 0)
-    local_input_ = input_.substr(0, delta);
-  else {
-    std::string buffer;
-    buffer.resize(delta);
-    // Other processes get substrings from root
-    world.recv(0, 0, buffer.data(), delta);
-    local_input_ = std::string(buffer.data(), delta);
   }
   result = 0;
   return true;
@@ -125,11 +89,8 @@ bool kabalova_v_count_symbols_mpi::TestMPITaskParallel::validation() {
 
 bool kabalova_v_count_symbols_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  int local_result = 0;
-  // Count symbols in every substring
-  local_result = countSymbols(local_input_);
-  // Get sum and send it into result
-  reduce(world, local_result, result, std::plus(), 0);
+  // Count symbols in every substring and get the sum in root
+  result = static_cast<int>(ppc::mpi::scan_text(world, *taskData, input_.data(), input_.size()).letters);
   return true;
 }
 
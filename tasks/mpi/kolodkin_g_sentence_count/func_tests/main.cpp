@@ -3,6 +3,8 @@
 
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
+#include <cstddef>
+#include <string>
 #include <vector>
 
 #include "mpi/kolodkin_g_sentence_count/include/ops_mpi.hpp"
@@ -303,4 +305,51 @@ TEST(Parallel_Operations_MPI, Big_text) {
     ASSERT_EQ(reference_out[0], global_out[0]);
     ASSERT_EQ(reference_out[0], 7);
   }
-}
\ No newline at end of file
+}
+
+TEST(Parallel_Operations_MPI, Test_runs_of_terminators_split_between_ranks) {
+  boost::mpi::communicator world;
+
+  // a run of terminators ends one sentence, also where the blocks of the
+  // ranks cut it; the longer the runs, the more cuts fall inside them
+  for (std::size_t run : {1, 2, 5, 13}) {
+    std::vector<char> global_str;
+    std::vector<int> global_out(1, 0);
+
+    std::shared_ptr<ppc::core::TaskData> taskDataMpi = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      std::string str = "Wait" + std::string(run, '.') + " What" + std::string(run, '?') + std::string(run, '!') +
+                        " Stop" + std::string(run, '.');
+      global_str.assign(str.begin(), str.end());
+      taskDataMpi->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_str.data()));
+      taskDataMpi->inputs_count.emplace_back(global_str.size());
+      taskDataMpi->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_out.data()));
+      taskDataMpi->outputs_count.emplace_back(global_out.size());
+    }
+
+    kolodkin_g_sentence_count_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataMpi);
+    ASSERT_EQ(testMpiTaskParallel.validation(), true);
+    testMpiTaskParallel.pre_processing();
+    testMpiTaskParallel.run();
+    testMpiTaskParallel.post_processing();
+
+    if (world.rank() == 0) {
+      std::vector<int> reference_out(1, 0);
+
+      std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+      taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_str.data()));
+      taskDataSeq->inputs_count.emplace_back(global_str.size());
+      taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(reference_out.data()));
+      taskDataSeq->outputs_count.emplace_back(reference_out.size());
+
+      kolodkin_g_sentence_count_mpi::TestMPITaskSequential testTaskSequential(taskDataSeq);
+      ASSERT_EQ(testTaskSequential.validation(), true);
+      testTaskSequential.pre_processing();
+      testTaskSequential.run();
+      testTaskSequential.post_processing();
+
+      ASSERT_EQ(reference_out[0], 3) << run;
+      ASSERT_EQ(global_out[0], 3) << run;
+    }
+  }
+}
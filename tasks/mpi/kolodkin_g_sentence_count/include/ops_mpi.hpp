@@ -11,7 +11,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/simd/include/text_scan.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/text_scan/include/text_scan.hpp"
 
 namespace kolodkin_g_sentence_count_mpi {
 
@@ -37,9 +39,8 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<char> input_, local_input_;
+  std::vector<char> input_;
   int res{};
-  int localSentenceCount{};
   boost::mpi::communicator world;
 };
 
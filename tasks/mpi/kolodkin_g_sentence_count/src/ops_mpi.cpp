@@ -27,12 +27,7 @@ bool kolodkin_g_sentence_count_mpi::TestMPITaskSequential::validation() {
 
 bool kolodkin_g_sentence_count_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  for (unsigned long i = 0; i < input_.size(); i++) {
-    if ((input_[i] == '.' || input_[i] == '!' || input_[i] == '?') &&
-        ((input_[i + 1] != '.' && input_[i + 1] != '!' && input_[i + 1] != '?') || i + 1 == input_.size())) {
-      res++;
-    }
-  }
+  res = static_cast<int>(ppc::core::scan_text(input_.data(), input_.size()).sentences);
   return true;
 }
 
@@ -44,12 +39,6 @@ bool kolodkin_g_sentence_count_mpi::TestMPITaskSequential::post_processing() {
 
 bool kolodkin_g_sentence_count_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  if (world.rank() == 0) {
-    delta = taskData->inputs_count[0] / world.size();
-  }
-  broadcast(world, delta, 0);
-
   if (world.rank() == 0) {
     input_ = std::vector<char>(taskData->inputs_count[0]);
     auto* tmp_ptr = reinterpret_cast<char*>(taskData->inputs[0]);
@@ -57,16 +46,6 @@ bool kolodkin_g_sentence_count_mpi::TestMPITaskParallel::pre_processing() {
       input_[i] = tmp_ptr[i];
     }
   }
-  local_input_.resize(delta);
-  if (world.rank() == 0) {
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * delta, delta);
-    }
-    local_input_ = std::vector<char>(input_.begin(), input_.begin() + delta);
-  } else {
-    world.recv(0, 0, local_input_.data(), delta);
-  }
-  localSentenceCount = 0;
   res = 0;
   return true;
 }
@@ -81,14 +60,8 @@ bool kolodkin_g_sentence_count_mpi::TestMPITaskParallel::validation() {
 
 bool kolodkin_g_sentence_count_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  for (unsigned long i = 0; i < local_input_.size(); i++) {
-    if ((local_input_[i] == '.' || local_input_[i] == '!' || local_input_[i] == '?') &&
-        ((local_input_[i + 1] != '.' && local_input_[i + 1] != '!' && local_input_[i + 1] != '?') ||
-         i + 1 == local_input_.size())) {
-      localSentenceCount++;
-    }
-  }
-  reduce(world, localSentenceCount, res, std::plus<>(), 0);
+  // every rank scans a block of the text, a run of terminators cut between blocks is one sentence
+  res = static_cast<int>(ppc::mpi::scan_text(world, *taskData, input_.data(), input_.size()).sentences);
   return true;
 }
 
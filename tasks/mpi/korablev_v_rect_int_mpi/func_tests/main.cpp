@@ -4,6 +4,8 @@
 #include <boost/mpi/communicator.hpp>
 #include <boost/mpi/environment.hpp>
 #include <cmath>
+#include <cstdint>
+#include <span>
 #include <vector>
 
 #include "mpi/korablev_v_rect_int_mpi/include/ops_mpi.hpp"
@@ -259,3 +261,121 @@ TEST(korablev_v_rect_int, test_remainder_case) {
     ASSERT_NEAR(reference_result[0], global_result[0], 1e-3);
   }
 }
+
+TEST(korablev_v_rect_int, test_adaptive_integration) {
+  boost::mpi::communicator world;
+  std::vector<double> global_result(1, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  double a = 0.0;
+  double b = 1.0;
+  double tolerance = 1e-10;
+
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&a));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&b));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&tolerance));
+    taskDataPar->inputs_count.emplace_back(1);
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+    taskDataPar->outputs_count.emplace_back(global_result.size());
+  }
+
+  // a sharp peak, the pieces around it cost far more than the rest
+  auto peak = [](double x) { return 1.0 / (1e-4 + ((x - 0.3) * (x - 0.3))); };
+  for (auto rule : {ppc::core::SIMPSON, ppc::core::GAUSS_KRONROD_15}) {
+    korablev_v_rect_int_mpi::AdaptiveIntegrationParallel parallelTask(taskDataPar, rule);
+    parallelTask.set_function(peak);
+    ASSERT_EQ(parallelTask.validation(), true);
+    parallelTask.pre_processing();
+    parallelTask.run();
+    parallelTask.post_processing();
+
+    if (world.rank() == 0) {
+      std::vector<double> reference_result(1, 0);
+      std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+      taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&a));
+      taskDataSeq->inputs_count.emplace_back(1);
+      taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&b));
+      taskDataSeq->inputs_count.emplace_back(1);
+      taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&tolerance));
+      taskDataSeq->inputs_count.emplace_back(1);
+      taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(reference_result.data()));
+      taskDataSeq->outputs_count.emplace_back(reference_result.size());
+
+      korablev_v_rect_int_mpi::AdaptiveIntegrationSequential sequentialTask(taskDataSeq, rule);
+      sequentialTask.set_function(peak);
+      ASSERT_EQ(sequentialTask.validation(), true);
+      sequentialTask.pre_processing();
+      sequentialTask.run();
+      sequentialTask.post_processing();
+
+      double exact = (std::atan(0.7 / 1e-2) + std::atan(0.3 / 1e-2)) / 1e-2;
+      ASSERT_NEAR(global_result[0], exact, 1e-8);
+      ASSERT_NEAR(reference_result[0], exact, 1e-8);
+      EXPECT_LE(parallelTask.result().error, tolerance);
+      EXPECT_GT(parallelTask.result().evaluations, 0);
+    }
+  }
+}
+
+TEST(korablev_v_rect_int, test_multidim_integration) {
+  boost::mpi::communicator world;
+  std::vector<double> global_result(1, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  std::vector<double> lower = {-1.0, -1.0, -1.0, -1.0, -1.0};
+  std::vector<double> upper = {1.0, 1.0, 1.0, 1.0, 1.0};
+
+  auto gauss = [](std::span<const double> x) {
+    double r2 = 0.0;
+    for (double xi : x) {
+      r2 += xi * xi;
+    }
+    return std::exp(-r2);
+  };
+
+  for (auto method : {ppc::core::TENSOR_GRID, ppc::core::HALTON, ppc::core::SOBOL}) {
+    std::uint64_t points = method == ppc::core::TENSOR_GRID ? 12 : 5000;
+    if (world.rank() == 0) {
+      taskDataPar = std::make_shared<ppc::core::TaskData>();
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(lower.data()));
+      taskDataPar->inputs_count.emplace_back(lower.size());
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(upper.data()));
+      taskDataPar->inputs_count.emplace_back(upper.size());
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(&points));
+      taskDataPar->inputs_count.emplace_back(1);
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_result.data()));
+      taskDataPar->outputs_count.emplace_back(global_result.size());
+    }
+
+    korablev_v_rect_int_mpi::MultidimIntegrationParallel parallelTask(taskDataPar, method);
+    parallelTask.set_function(gauss);
+    ASSERT_EQ(parallelTask.validation(), true);
+    parallelTask.pre_processing();
+    parallelTask.run();
+    parallelTask.post_processing();
+
+    if (world.rank() == 0) {
+      std::vector<double> reference_result(1, 0);
+      std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>(*taskDataPar);
+      taskDataSeq->outputs[0] = reinterpret_cast<uint8_t*>(reference_result.data());
+
+      korablev_v_rect_int_mpi::MultidimIntegrationSequential sequentialTask(taskDataSeq, method);
+      sequentialTask.set_function(gauss);
+      ASSERT_EQ(sequentialTask.validation(), true);
+      sequentialTask.pre_processing();
+      sequentialTask.run();
+      sequentialTask.post_processing();
+
+      // the same items are summed, only in another order
+      ASSERT_NEAR(global_result[0], reference_result[0], 1e-10);
+      EXPECT_NEAR(parallelTask.result().error, sequentialTask.result().error, 1e-10);
+      double exact = std::pow(std::sqrt(M_PI) * std::erf(1.0), 5);
+      EXPECT_LE(std::abs(global_result[0] - exact), 5 * parallelTask.result().error);
+    }
+  }
+}
@@ -4,14 +4,20 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/integration/include/adaptive_quadrature.hpp"
+#include "core/integration/include/cubature.hpp"
+#include "core/integration/include/integration.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/scheduler/include/dynamic_scheduler.hpp"
 
 namespace korablev_v_rect_int_mpi {
 
@@ -24,15 +30,20 @@ class RectangularIntegrationSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
+  // type-erased integrand, called indirectly for every point
   void set_function(const std::function<double(double)>& func);
+  // any other callable is inlined into the sum and evaluated in batches
+  template <ppc::core::Integrand F>
+  void set_function(F func) {
+    sum_ = ppc::core::make_range_sum(std::move(func));
+  }
 
  private:
-  static double integrate(const std::function<double(double)>& f, double a, double b, int n);
   double a_{};
   double b_{};
   int n_{};
   double result_{};
-  std::function<double(double)> func_;
+  ppc::core::RangeSum sum_;
 };
 
 class RectangularIntegrationParallel : public ppc::core::Task {
@@ -45,16 +56,156 @@ class RectangularIntegrationParallel : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
+  // type-erased integrand, called indirectly for every point
   void set_function(const std::function<double(double)>& func);
+  // any other callable is inlined into the sum and evaluated in batches
+  template <ppc::core::Integrand F>
+  void set_function(F func) {
+    sum_ = ppc::core::make_range_sum(std::move(func));
+  }
 
  private:
-  double parallel_integrate(const std::function<double(double)>& f, double a, double b, int n);
+  double parallel_integrate(double a, double b, int n);
 
   double a_{};
   double b_{};
   int n_{};
   double global_result_{};
-  std::function<double(double)> func_;
+  ppc::core::RangeSum sum_;
+
+  boost::mpi::communicator world;
+};
+
+// Integral over [a, b] to an absolute tolerance with adaptive refinement;
+// inputs are a, b and the tolerance like a, b and n above.
+class AdaptiveIntegrationSequential : public ppc::core::Task {
+ public:
+  explicit AdaptiveIntegrationSequential(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                         ppc::core::QuadratureRule rule = ppc::core::GAUSS_KRONROD_15)
+      : Task(std::move(taskData_)), rule_(rule) {}
+
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  void set_function(const std::function<double(double)>& func);
+  template <ppc::core::Integrand F>
+  void set_function(F func) {
+    integral_ = ppc::core::make_adaptive_integral(std::move(func), rule_);
+  }
+
+  // value, error estimate and evaluations of the last run
+  [[nodiscard]] const ppc::core::QuadratureResult& result() const { return result_; }
+
+ private:
+  ppc::core::QuadratureRule rule_;
+  double a_{};
+  double b_{};
+  double tolerance_{};
+  ppc::core::QuadratureResult result_;
+  ppc::core::AdaptiveIntegral integral_;
+};
+
+// The range is cut into pieces handed out to ranks on demand, every piece
+// is refined to its share of the tolerance, so ranks that get the hard
+// parts of the integrand take fewer pieces. The result (error estimate and
+// evaluations summed over all ranks) is significant on the root.
+class AdaptiveIntegrationParallel : public ppc::core::Task {
+ public:
+  explicit AdaptiveIntegrationParallel(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                       ppc::core::QuadratureRule rule = ppc::core::GAUSS_KRONROD_15)
+      : Task(std::move(taskData_)), rule_(rule) {}
+
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  void set_function(const std::function<double(double)>& func);
+  template <ppc::core::Integrand F>
+  void set_function(F func) {
+    integral_ = ppc::core::make_adaptive_integral(std::move(func), rule_);
+  }
+
+  [[nodiscard]] const ppc::core::QuadratureResult& result() const { return result_; }
+
+  static constexpr int kPiecesPerRank = 16;
+
+ private:
+  ppc::core::QuadratureRule rule_;
+  double a_{};
+  double b_{};
+  double tolerance_{};
+  ppc::core::QuadratureResult result_;
+  ppc::core::AdaptiveIntegral integral_;
+
+  boost::mpi::communicator world;
+};
+
+// Integral over the box [lower, upper] in several dimensions; inputs[0]
+// and inputs[1] are the bounds, inputs[2] the std::uint64_t number of
+// points (per dimension for the grid, per replica otherwise).
+class MultidimIntegrationSequential : public ppc::core::Task {
+ public:
+  explicit MultidimIntegrationSequential(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                         ppc::core::CubatureMethod method = ppc::core::SOBOL)
+      : Task(std::move(taskData_)), method_(method) {}
+
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  void set_function(const std::function<double(std::span<const double>)>& func);
+  template <ppc::core::MultiIntegrand F>
+  void set_function(F func) {
+    items_ = ppc::core::make_cubature_items(std::move(func));
+  }
+
+  // value, error estimate and evaluations of the last run
+  [[nodiscard]] const ppc::core::QuadratureResult& result() const { return result_; }
+
+ private:
+  ppc::core::CubatureMethod method_;
+  std::vector<double> lower_;
+  std::vector<double> upper_;
+  std::uint64_t points_{};
+  ppc::core::QuadratureResult result_;
+  ppc::core::CubatureItems items_;
+};
+
+// Work items of the cubature (blocks of grid points or of the points of
+// one replica) are handed out to ranks on demand, the partial sums of all
+// ranks are merged with a single vector reduction. The result is the same
+// for any number of ranks and significant on the root.
+class MultidimIntegrationParallel : public ppc::core::Task {
+ public:
+  explicit MultidimIntegrationParallel(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                       ppc::core::CubatureMethod method = ppc::core::SOBOL)
+      : Task(std::move(taskData_)), method_(method) {}
+
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  void set_function(const std::function<double(std::span<const double>)>& func);
+  template <ppc::core::MultiIntegrand F>
+  void set_function(F func) {
+    items_ = ppc::core::make_cubature_items(std::move(func));
+  }
+
+  // value, error estimate and evaluations of the last run
+  [[nodiscard]] const ppc::core::QuadratureResult& result() const { return result_; }
+
+ private:
+  ppc::core::CubatureMethod method_;
+  std::vector<double> lower_;
+  std::vector<double> upper_;
+  std::uint64_t points_{};
+  ppc::core::QuadratureResult result_;
+  ppc::core::CubatureItems items_;
 
   boost::mpi::communicator world;
 };
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/timer.hpp>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <span>
 #include <vector>
 
 #include "core/perf/include/perf.hpp"
@@ -41,6 +45,7 @@ TEST(korablev_v_rect_int, test_pipeline_run) {
   perfAnalyzer->pipeline_run(perfAttr, perfResults);
 
   if (world.rank() == 0) {
+    perfResults->counters["samples_per_sec"] = static_cast<double>(n) * perfAttr->num_running / perfResults->time_sec;
     ppc::core::Perf::print_perf_statistic(perfResults);
     double exact = 1.0 / 3.0;
     EXPECT_NEAR(output, exact, 1e-4);
@@ -82,8 +87,149 @@ TEST(korablev_v_rect_int, test_task_run) {
   perfAnalyzer->task_run(perfAttr, perfResults);
 
   if (world.rank() == 0) {
+    perfResults->counters["samples_per_sec"] = static_cast<double>(n) * perfAttr->num_running / perfResults->time_sec;
     ppc::core::Perf::print_perf_statistic(perfResults);
     double exact = 1.0 / 3.0;
     EXPECT_NEAR(output, exact, 1e-4);
   }
-}
\ No newline at end of file
+}
+
+TEST(korablev_v_rect_int, test_task_run_std_function) {
+  boost::mpi::communicator world;
+  double a = 0.0;
+  double b = 1.0;
+  int n = 1000000;
+  double output = 0.0;
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(&a));
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(&b));
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(&n));
+    taskDataPar->outputs.push_back(reinterpret_cast<uint8_t*>(&output));
+    taskDataPar->outputs_count.push_back(1);
+  }
+
+  auto testMpiTaskParallel = std::make_shared<korablev_v_rect_int_mpi::RectangularIntegrationParallel>(taskDataPar);
+  // type-erased fallback, one indirect call per point
+  std::function<double(double)> func = [](double x) { return x * x; };
+  testMpiTaskParallel->set_function(func);
+
+  ASSERT_TRUE(testMpiTaskParallel->validation());
+  testMpiTaskParallel->pre_processing();
+  testMpiTaskParallel->run();
+  testMpiTaskParallel->post_processing();
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+
+  if (world.rank() == 0) {
+    perfResults->counters["samples_per_sec"] = static_cast<double>(n) * perfAttr->num_running / perfResults->time_sec;
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    double exact = 1.0 / 3.0;
+    EXPECT_NEAR(output, exact, 1e-4);
+  }
+}
+
+TEST(korablev_v_rect_int, test_task_run_adaptive) {
+  boost::mpi::communicator world;
+  double a = 0.0;
+  double b = 1.0;
+  double tolerance = 1e-12;
+  double output = 0.0;
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(&a));
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(&b));
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(&tolerance));
+    taskDataPar->outputs.push_back(reinterpret_cast<uint8_t*>(&output));
+    taskDataPar->outputs_count.push_back(1);
+  }
+
+  auto testMpiTaskParallel = std::make_shared<korablev_v_rect_int_mpi::AdaptiveIntegrationParallel>(taskDataPar);
+  testMpiTaskParallel->set_function([](double x) { return 1.0 / (1e-6 + ((x - 0.3) * (x - 0.3))); });
+
+  ASSERT_TRUE(testMpiTaskParallel->validation());
+  testMpiTaskParallel->pre_processing();
+  testMpiTaskParallel->run();
+  testMpiTaskParallel->post_processing();
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+
+  if (world.rank() == 0) {
+    perfResults->counters["evaluations"] = static_cast<double>(testMpiTaskParallel->result().evaluations);
+    perfResults->counters["error_estimate"] = testMpiTaskParallel->result().error;
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    double exact = (std::atan(0.7 / 1e-3) + std::atan(0.3 / 1e-3)) / 1e-3;
+    EXPECT_NEAR(output, exact, 1e-9);
+  }
+}
+
+TEST(korablev_v_rect_int, test_task_run_multidim) {
+  boost::mpi::communicator world;
+  std::vector<double> lower(6, 0.0);
+  std::vector<double> upper(6, 1.0);
+  std::uint64_t points = 1 << 16;
+  double output = 0.0;
+
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(lower.data()));
+    taskDataPar->inputs_count.push_back(lower.size());
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(upper.data()));
+    taskDataPar->inputs_count.push_back(upper.size());
+    taskDataPar->inputs.push_back(reinterpret_cast<uint8_t*>(&points));
+    taskDataPar->inputs_count.push_back(1);
+    taskDataPar->outputs.push_back(reinterpret_cast<uint8_t*>(&output));
+    taskDataPar->outputs_count.push_back(1);
+  }
+
+  auto testMpiTaskParallel = std::make_shared<korablev_v_rect_int_mpi::MultidimIntegrationParallel>(taskDataPar);
+  testMpiTaskParallel->set_function([](std::span<const double> x) {
+    double product = 1.0;
+    for (double xi : x) {
+      product *= std::cos(xi);
+    }
+    return product;
+  });
+
+  ASSERT_TRUE(testMpiTaskParallel->validation());
+  testMpiTaskParallel->pre_processing();
+  testMpiTaskParallel->run();
+  testMpiTaskParallel->post_processing();
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+
+  if (world.rank() == 0) {
+    const auto& result = testMpiTaskParallel->result();
+    perfResults->counters["samples_per_sec"] =
+        static_cast<double>(result.evaluations) * perfAttr->num_running / perfResults->time_sec;
+    perfResults->counters["error_estimate"] = result.error;
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    EXPECT_NEAR(output, std::pow(std::sin(1.0), 6), 1e-5);
+  }
+}
@@ -1,11 +1,14 @@
 #include "mpi/korablev_v_rect_int_mpi/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <array>
 #include <boost/mpi.hpp>
 #include <chrono>
+#include <cstdint>
 #include <functional>
 #include <numeric>
 #include <random>
+#include <span>
 #include <string>
 #include <thread>
 #include <vector>
@@ -33,7 +36,8 @@ bool korablev_v_rect_int_mpi::RectangularIntegrationSequential::validation() {
 
 bool korablev_v_rect_int_mpi::RectangularIntegrationSequential::run() {
   internal_order_test();
-  result_ = integrate(func_, a_, b_, n_);
+  // left rectangles
+  result_ = sum_(a_, (b_ - a_) / n_, 0, n_);
   return true;
 }
 
@@ -43,22 +47,9 @@ bool korablev_v_rect_int_mpi::RectangularIntegrationSequential::post_processing(
   return true;
 }
 
-double korablev_v_rect_int_mpi::RectangularIntegrationSequential::integrate(const std::function<double(double)>& f,
-                                                                            double a, double b, int n) {
-  double h = (b - a) / n;
-  double sum = 0.0;
-
-  for (int i = 0; i < n; ++i) {
-    double x = a + i * h;
-    sum += f(x) * h;
-  }
-
-  return sum;
-}
-
 void korablev_v_rect_int_mpi::RectangularIntegrationSequential::set_function(
     const std::function<double(double)>& func) {
-  func_ = func;
+  sum_ = ppc::core::make_range_sum(func);
 }
 
 bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::pre_processing() {
@@ -92,7 +83,7 @@ bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::validation() {
 bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::run() {
   internal_order_test();
   double local_result_{};
-  local_result_ = parallel_integrate(func_, a_, b_, n_);
+  local_result_ = parallel_integrate(a_, b_, n_);
   reduce(world, local_result_, global_result_, std::plus<>(), 0);
   return true;
 }
@@ -105,22 +96,210 @@ bool korablev_v_rect_int_mpi::RectangularIntegrationParallel::post_processing()
   return true;
 }
 
-double korablev_v_rect_int_mpi::RectangularIntegrationParallel::parallel_integrate(
-    const std::function<double(double)>& f, double a, double b, int n) {
-  int rank = world.rank();
-  int size = world.size();
-
+double korablev_v_rect_int_mpi::RectangularIntegrationParallel::parallel_integrate(double a, double b, int n) {
   double h = (b - a) / n;
   double local_sum = 0.0;
 
-  for (int i = rank; i < n; i += size) {
-    double x = a + i * h;
-    local_sum += f(x) * h;
-  }
+  // f may cost differently over the range, so ranks take chunks on demand
+  ppc::mpi::DynamicScheduler scheduler(world, n);
+  scheduler.for_each([&](std::int64_t begin, std::int64_t end) { local_sum += sum_(a, h, begin, end); });
 
   return local_sum;
 }
 
 void korablev_v_rect_int_mpi::RectangularIntegrationParallel::set_function(const std::function<double(double)>& func) {
-  func_ = func;
+  sum_ = ppc::core::make_range_sum(func);
+}
+
+bool korablev_v_rect_int_mpi::AdaptiveIntegrationSequential::pre_processing() {
+  internal_order_test();
+
+  a_ = *reinterpret_cast<double*>(taskData->inputs[0]);
+  b_ = *reinterpret_cast<double*>(taskData->inputs[1]);
+  tolerance_ = *reinterpret_cast<double*>(taskData->inputs[2]);
+
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::AdaptiveIntegrationSequential::validation() {
+  internal_order_test();
+  return taskData->outputs_count[0] == 1 && *reinterpret_cast<double*>(taskData->inputs[2]) > 0.0;
+}
+
+bool korablev_v_rect_int_mpi::AdaptiveIntegrationSequential::run() {
+  internal_order_test();
+  result_ = integral_(a_, b_, tolerance_);
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::AdaptiveIntegrationSequential::post_processing() {
+  internal_order_test();
+  *reinterpret_cast<double*>(taskData->outputs[0]) = result_.value;
+  return true;
+}
+
+void korablev_v_rect_int_mpi::AdaptiveIntegrationSequential::set_function(const std::function<double(double)>& func) {
+  integral_ = ppc::core::make_adaptive_integral(func, rule_);
+}
+
+bool korablev_v_rect_int_mpi::AdaptiveIntegrationParallel::pre_processing() {
+  internal_order_test();
+
+  if (world.rank() == 0) {
+    a_ = *reinterpret_cast<double*>(taskData->inputs[0]);
+    b_ = *reinterpret_cast<double*>(taskData->inputs[1]);
+    tolerance_ = *reinterpret_cast<double*>(taskData->inputs[2]);
+  }
+
+  broadcast(world, a_, 0);
+  broadcast(world, b_, 0);
+  broadcast(world, tolerance_, 0);
+
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::AdaptiveIntegrationParallel::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    return taskData->outputs_count[0] == 1 && *reinterpret_cast<double*>(taskData->inputs[2]) > 0.0;
+  }
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::AdaptiveIntegrationParallel::run() {
+  internal_order_test();
+
+  std::int64_t pieces = static_cast<std::int64_t>(kPiecesPerRank) * world.size();
+  double width = (b_ - a_) / static_cast<double>(pieces);
+  // value, error estimate and evaluations of the pieces taken by this rank
+  std::array<double, 3> local{};
+  ppc::mpi::DynamicScheduler scheduler(world, pieces, 1);
+  scheduler.for_each([&](std::int64_t begin, std::int64_t end) {
+    for (auto i = begin; i < end; ++i) {
+      double lo = a_ + (static_cast<double>(i) * width);
+      double hi = i + 1 == pieces ? b_ : a_ + (static_cast<double>(i + 1) * width);
+      auto piece = integral_(lo, hi, tolerance_ / static_cast<double>(pieces));
+      local[0] += piece.value;
+      local[1] += piece.error;
+      local[2] += static_cast<double>(piece.evaluations);
+    }
+  });
+
+  std::array<double, 3> global{};
+  reduce(world, local.data(), 3, global.data(), std::plus<>(), 0);
+  result_ = {global[0], global[1], static_cast<std::int64_t>(global[2])};
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::AdaptiveIntegrationParallel::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    *reinterpret_cast<double*>(taskData->outputs[0]) = result_.value;
+  }
+  return true;
+}
+
+void korablev_v_rect_int_mpi::AdaptiveIntegrationParallel::set_function(const std::function<double(double)>& func) {
+  integral_ = ppc::core::make_adaptive_integral(func, rule_);
+}
+
+bool korablev_v_rect_int_mpi::MultidimIntegrationSequential::pre_processing() {
+  internal_order_test();
+
+  auto* lower = reinterpret_cast<double*>(taskData->inputs[0]);
+  auto* upper = reinterpret_cast<double*>(taskData->inputs[1]);
+  lower_.assign(lower, lower + taskData->inputs_count[0]);
+  upper_.assign(upper, upper + taskData->inputs_count[1]);
+  points_ = *reinterpret_cast<std::uint64_t*>(taskData->inputs[2]);
+
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::MultidimIntegrationSequential::validation() {
+  internal_order_test();
+  return taskData->inputs_count[0] == taskData->inputs_count[1] && taskData->outputs_count[0] == 1 &&
+         ppc::core::Cubature::supports(taskData->inputs_count[0], method_,
+                                       *reinterpret_cast<std::uint64_t*>(taskData->inputs[2]));
+}
+
+bool korablev_v_rect_int_mpi::MultidimIntegrationSequential::run() {
+  internal_order_test();
+  ppc::core::Cubature cubature(lower_, upper_, method_, points_);
+  std::vector<double> partials(cubature.partial_count());
+  items_(cubature, 0, cubature.items(), partials);
+  result_ = cubature.finish(partials);
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::MultidimIntegrationSequential::post_processing() {
+  internal_order_test();
+  *reinterpret_cast<double*>(taskData->outputs[0]) = result_.value;
+  return true;
+}
+
+void korablev_v_rect_int_mpi::MultidimIntegrationSequential::set_function(
+    const std::function<double(std::span<const double>)>& func) {
+  items_ = ppc::core::make_cubature_items(func);
+}
+
+bool korablev_v_rect_int_mpi::MultidimIntegrationParallel::pre_processing() {
+  internal_order_test();
+
+  if (world.rank() == 0) {
+    auto* lower = reinterpret_cast<double*>(taskData->inputs[0]);
+    auto* upper = reinterpret_cast<double*>(taskData->inputs[1]);
+    lower_.assign(lower, lower + taskData->inputs_count[0]);
+    upper_.assign(upper, upper + taskData->inputs_count[1]);
+    points_ = *reinterpret_cast<std::uint64_t*>(taskData->inputs[2]);
+  }
+
+  int dims = static_cast<int>(lower_.size());
+  broadcast(world, dims, 0);
+  lower_.resize(dims);
+  upper_.resize(dims);
+  broadcast(world, lower_.data(), dims, 0);
+  broadcast(world, upper_.data(), dims, 0);
+  broadcast(world, points_, 0);
+
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::MultidimIntegrationParallel::validation() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    return taskData->inputs_count[0] == taskData->inputs_count[1] && taskData->outputs_count[0] == 1 &&
+           ppc::core::Cubature::supports(taskData->inputs_count[0], method_,
+                                         *reinterpret_cast<std::uint64_t*>(taskData->inputs[2]));
+  }
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::MultidimIntegrationParallel::run() {
+  internal_order_test();
+
+  // same items and randomization on every rank
+  ppc::core::Cubature cubature(lower_, upper_, method_, points_);
+  std::vector<double> local(cubature.partial_count());
+  ppc::mpi::DynamicScheduler scheduler(world, cubature.items());
+  scheduler.for_each([&](std::int64_t begin, std::int64_t end) { items_(cubature, begin, end, local); });
+
+  std::vector<double> partials(local.size());
+  reduce(world, local.data(), static_cast<int>(local.size()), partials.data(), std::plus<>(), 0);
+  if (world.rank() == 0) {
+    result_ = cubature.finish(partials);
+  }
+  return true;
+}
+
+bool korablev_v_rect_int_mpi::MultidimIntegrationParallel::post_processing() {
+  internal_order_test();
+  if (world.rank() == 0) {
+    *reinterpret_cast<double*>(taskData->outputs[0]) = result_.value;
+  }
+  return true;
+}
+
+void korablev_v_rect_int_mpi::MultidimIntegrationParallel::set_function(
+    const std::function<double(std::span<const double>)>& func) {
+  items_ = ppc::core::make_cubature_items(func);
 }
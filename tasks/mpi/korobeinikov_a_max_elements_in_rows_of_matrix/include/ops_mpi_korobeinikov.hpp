@@ -11,7 +11,11 @@
 #include <utility>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/matrix_reduction/include/matrix_reduction.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace korobeinikov_a_test_task_mpi {
 
@@ -26,10 +30,10 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  ppc::core::Matrix<int> input_;
   std::vector<int> res;
-  int count_rows;
-  int size_rows;
+  int count_rows{};
+  int size_rows{};
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -41,11 +45,11 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_, local_input_;
+  ppc::core::Matrix<int> input_;
+  std::vector<int> storage_;
+  ppc::core::Matrix<const int> local_input_;
   std::vector<int> res;
-  int count_rows;
-  int size_rows;
-  int num_use_proc;
+  int count_rows{};
   boost::mpi::communicator world;
 };
 
@@ -11,7 +11,11 @@
 #include <utility>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/matrix_reduction/include/matrix_reduction.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace korovin_n_min_val_row_matrix_mpi {
 
@@ -26,7 +30,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   static std::vector<std::vector<int>> generate_rnd_matrix(int rows, int cols);
 
  private:
-  std::vector<std::vector<int>> input_;
+  ppc::core::Matrix<int> input_;
   std::vector<int> res_;
 };
 
@@ -39,8 +43,9 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<int>> input_;
-  std::vector<std::vector<int>> local_input_;
+  ppc::core::Matrix<int> input_;
+  std::vector<int> storage_;
+  ppc::core::Matrix<const int> local_input_;
   std::vector<int> res_;
   boost::mpi::communicator world;
 };
@@ -13,18 +13,8 @@ using namespace std::chrono_literals;
 bool korovin_n_min_val_row_matrix_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
 
-  int rows = taskData->inputs_count[0];
-  int cols = taskData->inputs_count[1];
-
-  input_.resize(rows, std::vector<int>(cols));
-
-  for (int i = 0; i < rows; i++) {
-    int* input_matrix = reinterpret_cast<int*>(taskData->inputs[i]);
-    for (int j = 0; j < cols; j++) {
-      input_[i][j] = input_matrix[j];
-    }
-  }
-  res_.resize(rows);
+  input_ = ppc::core::matrix_from_rows<int>(*taskData, taskData->inputs_count[0], taskData->inputs_count[1]);
+  res_.resize(input_.rows());
   return true;
 }
 
@@ -38,15 +28,7 @@ bool korovin_n_min_val_row_matrix_mpi::TestMPITaskSequential::validation() {
 bool korovin_n_min_val_row_matrix_mpi::TestMPITaskSequential::run() {
   internal_order_test();
 
-  for (size_t i = 0; i < input_.size(); i++) {
-    int min_val = input_[i][0];
-    for (size_t j = 1; j < input_[i].size(); j++) {
-      if (input_[i][j] < min_val) {
-        min_val = input_[i][j];
-      }
-    }
-    res_[i] = min_val;
-  }
+  ppc::core::reduce_matrix<ppc::core::MIN>(input_, ppc::core::BY_ROW, res_);
   return true;
 }
 
@@ -63,49 +45,10 @@ bool korovin_n_min_val_row_matrix_mpi::TestMPITaskSequential::post_processing()
 bool korovin_n_min_val_row_matrix_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
 
-  int rows = 0;
-  int cols = 0;
-
-  if (world.rank() == 0) {
-    rows = taskData->inputs_count[0];
-    cols = taskData->inputs_count[1];
-  }
-
-  broadcast(world, rows, 0);
-  broadcast(world, cols, 0);
-
-  int delta = rows / world.size();
-  int extra = rows % world.size();
-
   if (world.rank() == 0) {
-    input_.resize(rows, std::vector<int>(cols));
-    for (int i = 0; i < rows; i++) {
-      int* input_matrix = reinterpret_cast<int*>(taskData->inputs[i]);
-      input_[i].assign(input_matrix, input_matrix + cols);
-    }
-
-    for (int proc = 1; proc < world.size(); proc++) {
-      int start_row = proc * delta + std::min(proc, extra);
-      int num_rows = delta + (proc < extra ? 1 : 0);
-      for (int r = start_row; r < start_row + num_rows; r++) {
-        world.send(proc, 0, input_[r].data(), cols);
-      }
-    }
+    input_ = ppc::core::matrix_from_rows<int>(*taskData, taskData->inputs_count[0], taskData->inputs_count[1]);
   }
-
-  int local_rows = delta + (world.rank() < extra ? 1 : 0);
-
-  local_input_.resize(local_rows, std::vector<int>(cols));
-
-  if (world.rank() == 0) {
-    std::copy(input_.begin(), input_.begin() + local_rows, local_input_.begin());
-  } else {
-    for (int r = 0; r < local_rows; r++) {
-      world.recv(0, 0, local_input_[r].data(), cols);
-    }
-  }
-
-  res_.resize(rows);
+  local_input_ = ppc::mpi::scatter_rows(world, input_, storage_);
   return true;
 }
 
@@ -123,30 +66,9 @@ bool korovin_n_min_val_row_matrix_mpi::TestMPITaskParallel::validation() {
 bool korovin_n_min_val_row_matrix_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  std::vector<int> local_mins(local_input_.size(), INT_MAX);
-  for (size_t i = 0; i < local_input_.size(); i++) {
-    for (const auto& val : local_input_[i]) {
-      local_mins[i] = std::min(local_mins[i], val);
-    }
-  }
-
-  if (world.rank() == 0) {
-    int current_ind = 0;
-    std::copy(local_mins.begin(), local_mins.end(), res_.begin());
-    current_ind += local_mins.size();
-    for (int proc = 1; proc < world.size(); proc++) {
-      int loc_size;
-      world.recv(proc, 0, &loc_size, 1);
-      std::vector<int> loc_res_(loc_size);
-      world.recv(proc, 0, loc_res_.data(), loc_size);
-      copy(loc_res_.begin(), loc_res_.end(), res_.data() + current_ind);
-      current_ind += loc_res_.size();
-    }
-  } else {
-    int loc_res__size = (int)local_mins.size();
-    world.send(0, 0, &loc_res__size, 1);
-    world.send(0, 0, local_mins.data(), loc_res__size);
-  }
+  std::vector<int> local_mins;
+  ppc::core::reduce_matrix<ppc::core::MIN>(local_input_, ppc::core::BY_ROW, local_mins);
+  ppc::mpi::combine_partials<ppc::core::MIN>(world, *taskData, ppc::core::BY_ROW, local_mins, res_);
   return true;
 }
 
@@ -10,7 +10,11 @@
 #include <utility>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/matrix_reduction/include/matrix_reduction.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace kurakin_m_min_values_by_rows_matrix_mpi {
 
@@ -27,7 +31,7 @@ class TestMPITaskSequential : public ppc::core::Task {
  private:
   int count_rows{};
   int size_rows{};
-  std::vector<int> input_;
+  ppc::core::Matrix<int> input_;
   std::vector<int> res;
 };
 
@@ -42,7 +46,9 @@ class TestMPITaskParallel : public ppc::core::Task {
  private:
   int count_rows{};
   int size_rows{};
-  std::vector<int> input_, local_input_;
+  ppc::core::Matrix<int> input_;
+  std::vector<int> storage_;
+  ppc::core::Matrix<const int> local_input_;
   std::vector<int> res;
   boost::mpi::communicator world;
 };
@@ -2,6 +2,7 @@
 #include "mpi/kurakin_m_min_values_by_rows_matrix/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <random>
 #include <thread>
@@ -21,14 +22,10 @@ std::vector<int> kurakin_m_min_values_by_rows_matrix_mpi::getRandomVector(int sz
 
 bool kurakin_m_min_values_by_rows_matrix_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
-
-  count_rows = (int)*taskData->inputs[1];
-  size_rows = (int)*taskData->inputs[2];
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
+  // the flat input viewed as count_rows x size_rows, without a copy
+  count_rows = *reinterpret_cast<int*>(taskData->inputs[1]);
+  size_rows = *reinterpret_cast<int*>(taskData->inputs[2]);
+  input_ = ppc::core::matrix_from_input<int>(*taskData, 0, count_rows, size_rows);
   res = std::vector<int>(count_rows, 0);
   return true;
 }
@@ -36,15 +33,14 @@ bool kurakin_m_min_values_by_rows_matrix_mpi::TestMPITaskSequential::pre_process
 bool kurakin_m_min_values_by_rows_matrix_mpi::TestMPITaskSequential::validation() {
   internal_order_test();
 
-  return *taskData->inputs[1] != 0 && *taskData->inputs[2] != 0 && *taskData->inputs[1] == taskData->outputs_count[0];
+  int rows = *reinterpret_cast<int*>(taskData->inputs[1]);
+  int cols = *reinterpret_cast<int*>(taskData->inputs[2]);
+  return rows != 0 && cols != 0 && static_cast<std::uint64_t>(rows) == taskData->outputs_count[0];
 }
 
 bool kurakin_m_min_values_by_rows_matrix_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-
-  for (int i = 0; i < count_rows; i++) {
-    res[i] = *std::min_element(input_.begin() + i * size_rows, input_.begin() + (i + 1) * size_rows);
-  }
+  ppc::core::reduce_matrix<ppc::core::MIN>(input_, ppc::core::BY_ROW, res);
   return true;
 }
 
@@ -62,42 +58,22 @@ bool kurakin_m_min_values_by_rows_matrix_mpi::TestMPITaskParallel::pre_processin
 
   count_rows = 0;
   size_rows = 0;
-
-  unsigned int delta = 0;
-
   if (world.rank() == 0) {
-    count_rows = (int)*taskData->inputs[1];
-    size_rows = (int)*taskData->inputs[2];
-    if (taskData->inputs_count[0] % world.size() == 0) {
-      delta = taskData->inputs_count[0] / world.size();
-    } else {
-      delta = taskData->inputs_count[0] / world.size() + 1;
-    }
-  }
-
-  broadcast(world, count_rows, 0);
-  broadcast(world, size_rows, 0);
-  broadcast(world, delta, 0);
-
-  if (world.rank() == 0) {
-    input_ = std::vector<int>(delta * world.size(), INT_MAX);
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
+    count_rows = *reinterpret_cast<int*>(taskData->inputs[1]);
+    size_rows = *reinterpret_cast<int*>(taskData->inputs[2]);
+    input_ = ppc::core::matrix_from_input<int>(*taskData, 0, count_rows, size_rows);
   }
-
-  local_input_ = std::vector<int>(delta);
-  boost::mpi::scatter(world, input_.data(), local_input_.data(), delta, 0);
-
-  res = std::vector<int>(count_rows, INT_MAX);
+  // blocks of whole rows, so no row is split between ranks
+  local_input_ = ppc::mpi::scatter_rows(world, input_, storage_);
   return true;
 }
 
 bool kurakin_m_min_values_by_rows_matrix_mpi::TestMPITaskParallel::validation() {
   internal_order_test();
   if (world.rank() == 0) {
-    return *taskData->inputs[1] != 0 && *taskData->inputs[2] != 0 && *taskData->inputs[1] == taskData->outputs_count[0];
+    int rows = *reinterpret_cast<int*>(taskData->inputs[1]);
+    int cols = *reinterpret_cast<int*>(taskData->inputs[2]);
+    return rows != 0 && cols != 0 && static_cast<std::uint64_t>(rows) == taskData->outputs_count[0];
   }
   return true;
 }
@@ -105,36 +81,9 @@ bool kurakin_m_min_values_by_rows_matrix_mpi::TestMPITaskParallel::validation()
 bool kurakin_m_min_values_by_rows_matrix_mpi::TestMPITaskParallel::run() {
   internal_order_test();
 
-  unsigned int last_delta = 0;
-  if (world.rank() == world.size() - 1) {
-    last_delta = local_input_.size() * world.size() - size_rows * count_rows;
-  }
-
-  unsigned int ind = world.rank() * local_input_.size() / size_rows;
-  for (unsigned int i = 0; i < ind; ++i) {
-    reduce(world, INT_MAX, res[i], boost::mpi::minimum<int>(), 0);
-  }
-
-  unsigned int delta = std::min(local_input_.size(), size_rows - world.rank() * local_input_.size() % size_rows);
-  int local_res;
-
-  local_res = *std::min_element(local_input_.begin(), local_input_.begin() + delta);
-  reduce(world, local_res, res[ind], boost::mpi::minimum<int>(), 0);
-  ++ind;
-
-  unsigned int k = 0;
-  while (local_input_.begin() + delta + k * size_rows < local_input_.end() - last_delta) {
-    local_res = *std::min_element(local_input_.begin() + delta + k * size_rows,
-                                  std::min(local_input_.end(), local_input_.begin() + delta + (k + 1) * size_rows));
-    reduce(world, local_res, res[ind], boost::mpi::minimum<int>(), 0);
-    ++k;
-    ++ind;
-  }
-
-  for (unsigned int i = ind; i < res.size(); ++i) {
-    reduce(world, INT_MAX, res[i], boost::mpi::minimum<int>(), 0);
-  }
-
+  std::vector<int> local_mins;
+  ppc::core::reduce_matrix<ppc::core::MIN>(local_input_, ppc::core::BY_ROW, local_mins);
+  ppc::mpi::combine_partials<ppc::core::MIN>(world, *taskData, ppc::core::BY_ROW, local_mins, res);
   return true;
 }
 
@@ -178,4 +178,53 @@ TEST(lopatin_i_count_words_mpi, test_6k_words) {
 
     ASSERT_EQ(wordCount[0], referenceWordCount[0]);
   }
-}
\ No newline at end of file
+}
+
+TEST(lopatin_i_count_words_mpi, test_words_between_runs_of_whitespace) {
+  boost::mpi::communicator world;
+  // words are runs of non-whitespace bytes: leading, trailing and repeated
+  // spaces, tabs and newlines don't add words, also where the runs are cut
+  // between ranks
+  std::string testString = "  Leading,\tspaces  and\n\ntabs   between words  ";
+  for (int repeats : {1, 7}) {
+    std::vector<char> input;
+    for (int i = 0; i < repeats; i++) {
+      input.insert(input.end(), testString.begin(), testString.end());
+    }
+    std::vector<int> wordCount(1, 0);
+
+    std::shared_ptr<ppc::core::TaskData> taskDataParallel = std::make_shared<ppc::core::TaskData>();
+
+    if (world.rank() == 0) {
+      taskDataParallel->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+      taskDataParallel->inputs_count.emplace_back(input.size());
+      taskDataParallel->outputs.emplace_back(reinterpret_cast<uint8_t *>(wordCount.data()));
+      taskDataParallel->outputs_count.emplace_back(wordCount.size());
+    }
+
+    lopatin_i_count_words_mpi::TestMPITaskParallel testTaskParallel(taskDataParallel);
+    ASSERT_TRUE(testTaskParallel.validation());
+    testTaskParallel.pre_processing();
+    testTaskParallel.run();
+    testTaskParallel.post_processing();
+
+    if (world.rank() == 0) {
+      std::vector<int> referenceWordCount(1, 0);
+      std::shared_ptr<ppc::core::TaskData> taskDataSequential = std::make_shared<ppc::core::TaskData>();
+
+      taskDataSequential->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+      taskDataSequential->inputs_count.emplace_back(input.size());
+      taskDataSequential->outputs.emplace_back(reinterpret_cast<uint8_t *>(referenceWordCount.data()));
+      taskDataSequential->outputs_count.emplace_back(referenceWordCount.size());
+
+      lopatin_i_count_words_mpi::TestMPITaskSequential testTaskSequential(taskDataSequential);
+      ASSERT_TRUE(testTaskSequential.validation());
+      testTaskSequential.pre_processing();
+      testTaskSequential.run();
+      testTaskSequential.post_processing();
+
+      ASSERT_EQ(referenceWordCount[0], 6 * repeats);
+      ASSERT_EQ(wordCount[0], 6 * repeats);
+    }
+  }
+}
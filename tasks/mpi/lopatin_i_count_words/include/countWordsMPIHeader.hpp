@@ -7,7 +7,9 @@
 #include <string>
 #include <vector>
 
+#include "core/simd/include/text_scan.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/text_scan/include/text_scan.hpp"
 
 namespace lopatin_i_count_words_mpi {
 
@@ -24,7 +26,6 @@ class TestMPITaskSequential : public ppc::core::Task {
  private:
   std::vector<char> input_;
   int wordCount{};
-  int spaceCount{};
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -37,10 +38,7 @@ class TestMPITaskParallel : public ppc::core::Task {
 
  private:
   std::vector<char> input_;
-  std::vector<char> localInput_;
   int wordCount{};
-  int spaceCount{};
-  int localSpaceCount{};
   boost::mpi::communicator world;
 };
 
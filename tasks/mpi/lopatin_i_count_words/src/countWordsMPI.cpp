@@ -30,12 +30,7 @@ bool TestMPITaskSequential::validation() {
 
 bool TestMPITaskSequential::run() {
   internal_order_test();
-  for (char c : input_) {
-    if (c == ' ') {
-      spaceCount++;
-    }
-  }
-  wordCount = spaceCount + 1;
+  wordCount = static_cast<int>(ppc::core::scan_text(input_.data(), input_.size()).words);
   return true;
 }
 
@@ -47,25 +42,12 @@ bool TestMPITaskSequential::post_processing() {
 
 bool TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int chunkSize = 0;
   if (world.rank() == 0) {
     input_ = std ::vector<char>(taskData->inputs_count[0]);
     auto* tmpPtr = reinterpret_cast<char*>(taskData->inputs[0]);
     for (unsigned long int i = 0; i < taskData->inputs_count[0]; i++) {
       input_[i] = tmpPtr[i];
     }
-    chunkSize = taskData->inputs_count[0] / world.size();
-  }
-  boost::mpi::broadcast(world, chunkSize, 0);
-
-  localInput_.resize(chunkSize);
-  if (world.rank() == 0) {
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_.data() + proc * chunkSize, chunkSize);
-    }
-    localInput_ = std::vector<char>(input_.begin(), input_.begin() + chunkSize);
-  } else {
-    world.recv(0, 0, localInput_.data(), chunkSize);
   }
   return true;
 }
@@ -77,15 +59,9 @@ bool TestMPITaskParallel::validation() {
 
 bool TestMPITaskParallel::run() {
   internal_order_test();
-  for (char c : localInput_) {
-    if (c == ' ') {
-      localSpaceCount++;
-    }
-  }
-  boost::mpi::reduce(world, localSpaceCount, spaceCount, std::plus<>(), 0);
-  if (world.rank() == 0) {
-    wordCount = spaceCount + 1;
-  }
+  // the blocks of all ranks, with the words cut between them counted once
+  auto counts = ppc::mpi::scan_text(world, *taskData, input_.data(), input_.size());
+  wordCount = static_cast<int>(counts.words);
   return true;
 }
 
@@ -201,3 +201,59 @@ TEST(muhina_m_min_of_vector_elements, Test_Min_RepeatingValues) {
     ASSERT_EQ(reference_min[0], global_min[0]);
   }
 }
+
+TEST(muhina_m_min_of_vector_elements, Test_Min_With_Global_Position) {
+  boost::mpi::communicator world;
+  std::vector<int> global_vec;
+  std::vector<int32_t> global_min(1, 0);
+  std::vector<uint64_t> global_index(1, 0);
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+
+  if (world.rank() == 0) {
+    // equal minima at 60 and at the end of the input in the last block, the first one (60) wins
+    global_vec.assign(103, 50);
+    global_vec[101] = -1;
+    global_vec[102] = -1;
+    global_vec[60] = -1;
+
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
+    taskDataPar->inputs_count.emplace_back(global_vec.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_min.data()));
+    taskDataPar->outputs_count.emplace_back(global_min.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(global_index.data()));
+    taskDataPar->outputs_count.emplace_back(global_index.size());
+  }
+
+  muhina_m_min_of_vector_elements_mpi::MinOfVectorMPIParallel minOfVectorMPIParalle(taskDataPar);
+  ASSERT_EQ(minOfVectorMPIParalle.validation(), true);
+  minOfVectorMPIParalle.pre_processing();
+  minOfVectorMPIParalle.run();
+  minOfVectorMPIParalle.post_processing();
+
+  if (world.rank() == 0) {
+    // Create data
+    std::vector<int32_t> reference_min(1, 0);
+    std::vector<uint64_t> reference_index(1, 0);
+
+    // Create TaskData
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(global_vec.data()));
+    taskDataSeq->inputs_count.emplace_back(global_vec.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(reference_min.data()));
+    taskDataSeq->outputs_count.emplace_back(reference_min.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(reference_index.data()));
+    taskDataSeq->outputs_count.emplace_back(reference_index.size());
+
+    // Create Task
+    muhina_m_min_of_vector_elements_mpi::MinOfVectorMPISequential minOfVectorMPISequential(taskDataSeq);
+    ASSERT_EQ(minOfVectorMPISequential.validation(), true);
+    minOfVectorMPISequential.pre_processing();
+    minOfVectorMPISequential.run();
+    minOfVectorMPISequential.post_processing();
+
+    ASSERT_EQ(reference_min[0], global_min[0]);
+    ASSERT_EQ(60ull, reference_index[0]);
+    ASSERT_EQ(60ull, global_index[0]);
+  }
+}
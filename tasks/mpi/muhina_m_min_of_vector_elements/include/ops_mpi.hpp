@@ -5,16 +5,22 @@
 
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <memory>
-#include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/hierarchical/include/hierarchical.hpp"
+#include "mpi_core/matrix_reduction/include/matrix_reduction.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace muhina_m_min_of_vector_elements_mpi {
-int vectorMin(std::vector<int, std::allocator<int>> v);
+// minimum and its first position plus `offset`
+ppc::core::Extremum<int> vectorMin(std::span<const int> v, std::uint64_t offset = 0);
 
 class MinOfVectorMPISequential : public ppc::core::Task {
  public:
@@ -27,6 +33,7 @@ class MinOfVectorMPISequential : public ppc::core::Task {
  private:
   std::vector<int> input_;
   int res_{};
+  std::uint64_t res_index_{};
 };
 
 class MinOfVectorMPIParallel : public ppc::core::Task {
@@ -38,9 +45,11 @@ class MinOfVectorMPIParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_, local_input_;
-  int res_{};
-  boost::mpi::communicator world_;
+  std::vector<int> local_storage_;
+  std::span<const int> local_input_;
+  std::uint64_t offset_{};
+  ppc::core::Extremum<int> res_{};
+  ppc::mpi::HierarchicalCommunicator world_;
 };
 
 }  // namespace muhina_m_min_of_vector_elements_mpi
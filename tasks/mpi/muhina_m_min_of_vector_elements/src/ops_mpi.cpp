@@ -10,15 +10,9 @@
 
 using namespace std::chrono_literals;
 
-int muhina_m_min_of_vector_elements_mpi::vectorMin(std::vector<int, std::allocator<int>> vect) {
-  int mini = vect[0];
-
-  for (size_t i = 1; i < vect.size(); i++) {
-    if (vect[i] < mini) {
-      mini = vect[i];
-    }
-  }
-  return mini;
+ppc::core::Extremum<int> muhina_m_min_of_vector_elements_mpi::vectorMin(std::span<const int> vect,
+                                                                        std::uint64_t offset) {
+  return ppc::core::arg_reduce_elements<ppc::core::MIN>(vect.data(), vect.size(), offset);
 }
 
 bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPISequential::pre_processing() {
@@ -34,8 +28,8 @@ bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPISequential::pre_processi
 
 bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPISequential::validation() {
   internal_order_test();
-  // Check count elements of output
-  return taskData->outputs_count[0] == 1;
+  // Check count elements of output, the position of the minimum is optional
+  return taskData->outputs_count[0] == 1 && (taskData->outputs_count.size() < 2 || taskData->outputs_count[1] == 1);
 }
 
 bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPISequential::run() {
@@ -44,69 +38,59 @@ bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPISequential::run() {
     // Handle the case when the input vector is empty
     return true;
   }
-  res_ = muhina_m_min_of_vector_elements_mpi::vectorMin(input_);
+  auto min = muhina_m_min_of_vector_elements_mpi::vectorMin(input_);
+  res_ = min.value;
+  res_index_ = min.index;
   return true;
 }
 
 bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPISequential::post_processing() {
   internal_order_test();
   reinterpret_cast<int*>(taskData->outputs[0])[0] = res_;
+  if (taskData->outputs.size() > 1) {
+    reinterpret_cast<std::uint64_t*>(taskData->outputs[1])[0] = res_index_;
+  }
   return true;
 }
 
 bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPIParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  if (world_.rank() == 0) {
-    delta = taskData->inputs_count[0] / world_.size();
-  }
-  broadcast(world_, delta, 0);
-
-  if (world_.rank() == 0) {
-    // Init vectors
-    input_ = std::vector<int>(taskData->inputs_count[0]);
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-    for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-      input_[i] = tmp_ptr[i];
-    }
-    for (int proc = 1; proc < world_.size(); proc++) {
-      world_.send(proc, 0, input_.data() + proc * delta, delta);
-    }
-  }
-  local_input_ = std::vector<int>(delta);
-  if (world_.rank() == 0) {
-    local_input_ = std::vector<int>(input_.begin(), input_.begin() + delta);
-  } else {
-    world_.recv(0, 0, local_input_.data(), delta);
-  }
+  // the root keeps its block in place in the caller's buffer
+  local_input_ = ppc::mpi::scatter_input<int>(world_, *taskData, local_storage_);
+  offset_ = ppc::mpi::block_offset(world_, local_input_.size());
   return true;
 }
 
 bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPIParallel::validation() {
   internal_order_test();
   if (world_.rank() == 0) {
-    // Check count elements of output
-    return taskData->outputs_count[0] == 1;
+    // Check count elements of output, the position of the minimum is optional
+    return taskData->outputs_count[0] == 1 && (taskData->outputs_count.size() < 2 || taskData->outputs_count[1] == 1);
   }
   return true;
 }
 
 bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPIParallel::run() {
   internal_order_test();
-  if (local_input_.empty()) {
-    // Handle the case when the local input vector is empty
-    return true;
-  }
-  int local_min = muhina_m_min_of_vector_elements_mpi::vectorMin(local_input_);
+  // positions are global; ranks without elements report none and don't
+  // affect the minimum
+  auto local_min = muhina_m_min_of_vector_elements_mpi::vectorMin(local_input_, offset_);
 
-  reduce(world_, local_min, res_, boost::mpi::minimum<int>(), 0);
+  reduce(world_, local_min, res_, ppc::mpi::ExtremumOp<ppc::core::MIN, int>(), 0);
   return true;
 }
 
 bool muhina_m_min_of_vector_elements_mpi::MinOfVectorMPIParallel::post_processing() {
   internal_order_test();
   if (world_.rank() == 0) {
-    reinterpret_cast<int*>(taskData->outputs[0])[0] = res_;
+    if (res_.index == ppc::core::kNoIndex) {
+      // Handle the case when the input vector is empty
+      res_ = {};
+    }
+    reinterpret_cast<int*>(taskData->outputs[0])[0] = res_.value;
+    if (taskData->outputs.size() > 1) {
+      reinterpret_cast<std::uint64_t*>(taskData->outputs[1])[0] = res_.index;
+    }
   }
   return true;
 }
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/communicator.hpp>
+#include <cstdint>
 #include <random>
 #include <vector>
 
@@ -20,7 +21,7 @@ std::vector<int> createRandomVector(int v_size) {
 TEST(rezantseva_a_vector_dot_product_mpi, can_scalar_multiply_vec_size_125) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
   // Create TaskData
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
   if (world.rank() == 0) {
@@ -46,7 +47,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, can_scalar_multiply_vec_size_125) {
 
   if (world.rank() == 0) {
     // Create data
-    std::vector<int32_t> reference_res(1, 0);
+    std::vector<std::int64_t> reference_res(1, 0);
 
     // Create TaskData
     std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
@@ -72,7 +73,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, can_scalar_multiply_vec_size_125) {
 TEST(rezantseva_a_vector_dot_product_mpi, can_scalar_multiply_vec_size_300) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
 
   // Create TaskData
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
@@ -100,7 +101,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, can_scalar_multiply_vec_size_300) {
 
   if (world.rank() == 0) {
     // Create data
-    std::vector<int32_t> reference_res(1, 0);
+    std::vector<std::int64_t> reference_res(1, 0);
 
     // Create TaskData
     std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
@@ -126,7 +127,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, can_scalar_multiply_vec_size_300) {
 TEST(rezantseva_a_vector_dot_product_mpi, check_vectors_not_equal) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
 
   // Create TaskData
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
@@ -153,7 +154,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, check_vectors_not_equal) {
 TEST(rezantseva_a_vector_dot_product_mpi, check_vectors_equal_true) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
 
   // Create TaskData
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
@@ -187,7 +188,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_vectorDotProduct_right) {
 TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_right_size_5) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
   std::vector<int> v1 = {1, 2, 5, 6, 3};
   std::vector<int> v2 = {4, 7, 8, 9, 5};
   // Create TaskData
@@ -216,7 +217,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_right_size_5) {
 TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_right_size_3) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
   std::vector<int> v1 = {1, 2, 5};
   std::vector<int> v2 = {4, 7, 8};
   // Create TaskData
@@ -245,7 +246,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_right_size_3) {
 TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_right_size_7) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
   std::vector<int> v1 = {1, 2, 5, 14, 21, 16, 11};
   std::vector<int> v2 = {4, 7, 8, 12, 31, 25, 9};
   // Create TaskData
@@ -274,7 +275,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_right_size_7) {
 TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_right_empty) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
   std::vector<int> v1 = {0, 0, 0};
   std::vector<int> v2 = {0, 0, 0};
   // Create TaskData
@@ -298,4 +299,100 @@ TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_right_empty) {
   if (world.rank() == 0) {
     ASSERT_EQ(rezantseva_a_vector_dot_product_mpi::vectorDotProduct(v1, v2), res[0]);
   }
-}
\ No newline at end of file
+}
+
+TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_run_does_not_overflow_int) {
+  boost::mpi::communicator world;
+  // every product and every partial sum are far beyond int
+  const int count = 1001;
+  std::vector<int> v1(count, 2000000000);
+  std::vector<int> v2(count, -3000);
+  std::vector<std::int64_t> res(1, 0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(v1.data()));
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(v2.data()));
+    taskDataPar->inputs_count.emplace_back(v1.size());
+    taskDataPar->inputs_count.emplace_back(v2.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(res.data()));
+    taskDataPar->outputs_count.emplace_back(res.size());
+  }
+  rezantseva_a_vector_dot_product_mpi::TestMPITaskParallel testMpiTaskParallel(taskDataPar);
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+  if (world.rank() == 0) {
+    ASSERT_EQ(res[0], -6000000000000LL * count);
+    ASSERT_EQ(res[0], rezantseva_a_vector_dot_product_mpi::vectorDotProduct(v1, v2));
+  }
+}
+
+TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_floating_compensated_run) {
+  boost::mpi::communicator world;
+  // the ones cancel out in plain summation next to +-1e16
+  std::vector<double> v1;
+  std::vector<double> v2;
+  for (int i = 0; i < 100; i++) {
+    v1.insert(v1.end(), {1e16, 1.0, -1e16});
+    v2.insert(v2.end(), {1.0, 1.0, 1.0});
+  }
+  std::vector<double> res(1, 0.0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(v1.data()));
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(v2.data()));
+    taskDataPar->inputs_count.emplace_back(v1.size());
+    taskDataPar->inputs_count.emplace_back(v2.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(res.data()));
+    taskDataPar->outputs_count.emplace_back(res.size());
+  }
+  rezantseva_a_vector_dot_product_mpi::FloatingDotProductParallel<double> testMpiTaskParallel(taskDataPar,
+                                                                                              ppc::core::COMPENSATED);
+  ASSERT_EQ(testMpiTaskParallel.validation(), true);
+  testMpiTaskParallel.pre_processing();
+  testMpiTaskParallel.run();
+  testMpiTaskParallel.post_processing();
+  if (world.rank() == 0) {
+    ASSERT_DOUBLE_EQ(res[0], 100.0);
+  }
+}
+
+TEST(rezantseva_a_vector_dot_product_mpi, check_mpi_batched_matrix_vector_and_pairs) {
+  boost::mpi::communicator world;
+  const int rows = 13;
+  const int cols = 21;
+  std::vector<int> matrix(rows * cols);
+  std::vector<int> other(rows * cols);
+  for (int i = 0; i < rows * cols; i++) {
+    matrix[i] = (i % 17) - 8;
+    other[i] = (i % 5) + 1;
+  }
+  std::vector<int> x(other.begin(), other.begin() + cols);
+
+  for (bool pairs : {false, true}) {
+    std::vector<std::int64_t> res(rows, 0);
+    std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+    if (world.rank() == 0) {
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(matrix.data()));
+      taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(pairs ? other.data() : x.data()));
+      taskDataPar->inputs_count.emplace_back(matrix.size());
+      taskDataPar->inputs_count.emplace_back(pairs ? other.size() : x.size());
+      taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(res.data()));
+      taskDataPar->outputs_count.emplace_back(rows);
+    }
+    rezantseva_a_vector_dot_product_mpi::BatchedDotProductParallel testMpiTaskParallel(taskDataPar);
+    ASSERT_EQ(testMpiTaskParallel.validation(), true);
+    testMpiTaskParallel.pre_processing();
+    testMpiTaskParallel.run();
+    testMpiTaskParallel.post_processing();
+    if (world.rank() == 0) {
+      for (int r = 0; r < rows; r++) {
+        std::vector<int> row(matrix.begin() + (r * cols), matrix.begin() + ((r + 1) * cols));
+        std::vector<int> with(pairs ? other.begin() + (r * cols) : x.begin(),
+                              pairs ? other.begin() + ((r + 1) * cols) : x.end());
+        ASSERT_EQ(res[r], rezantseva_a_vector_dot_product_mpi::vectorDotProduct(row, with));
+      }
+    }
+  }
+}
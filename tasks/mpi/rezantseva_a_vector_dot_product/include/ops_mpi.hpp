@@ -2,18 +2,27 @@
 #pragma once
 #include <gtest/gtest.h>
 
+#include <array>
 #include <boost/mpi/collectives.hpp>
 #include <boost/mpi/communicator.hpp>
+#include <concepts>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/simd/include/dot_product.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/result_placement/include/result_placement.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace rezantseva_a_vector_dot_product_mpi {
-int vectorDotProduct(const std::vector<int>& v1, const std::vector<int>& v2);
+std::int64_t vectorDotProduct(const std::vector<int>& v1, const std::vector<int>& v2);
 
 class TestMPITaskSequential : public ppc::core::Task {
  public:
@@ -25,7 +34,7 @@ class TestMPITaskSequential : public ppc::core::Task {
 
  private:
   std::vector<std::vector<int>> input_;
-  int res{};
+  std::int64_t res{};
 };
 
 class TestMPITaskParallel : public ppc::core::Task {
@@ -37,11 +46,97 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<int>> input_{};
-  std::vector<int> local_input1_{}, local_input2_{};
-  std::vector<unsigned int> counts_{};
-  size_t num_processes_ = 0;
-  int res{};
+  std::vector<int> storage1_, storage2_;
+  std::span<const int> local_input1_, local_input2_;
+  std::int64_t res{};
+  boost::mpi::communicator world;
+};
+
+// Batched dot products as in the sequential task: rows of the N x K matrix
+// inputs[0] with one shared K-vector or with the rows of a second N x K
+// matrix. Every rank gets a block of whole rows, the shared vector is
+// broadcast; the N int64 results are placed by taskData->output_placement.
+class BatchedDotProductParallel : public ppc::core::Task {
+ public:
+  explicit BatchedDotProductParallel(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  std::uint64_t rows_{};
+  std::uint64_t cols_{};
+  bool pairs_{};
+  std::vector<int> matrix_storage_, other_storage_;
+  std::span<const int> local_matrix_, local_other_;
+  std::vector<std::int64_t> res_;
+  boost::mpi::communicator world;
+};
+
+// Dot product of two float or double vectors scattered in blocks. With
+// COMPENSATED the root gathers the unrounded partial sums of all ranks and
+// adds them up itself, a reduction in T would round every partial sum.
+template <std::floating_point T>
+class FloatingDotProductParallel : public ppc::core::Task {
+ public:
+  explicit FloatingDotProductParallel(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                      ppc::core::Summation summation = ppc::core::PLAIN)
+      : Task(std::move(taskData_)), summation_(summation) {}
+
+  bool validation() override {
+    internal_order_test();
+    if (world.rank() == 0) {
+      return taskData->inputs.size() == 2 && taskData->inputs_count.size() == 2 &&
+             taskData->inputs_count[0] == taskData->inputs_count[1] && taskData->outputs.size() == 1 &&
+             taskData->outputs_count.size() == 1 && taskData->outputs_count[0] == 1;
+    }
+    return true;
+  }
+
+  bool pre_processing() override {
+    internal_order_test();
+    local_a_ = ppc::mpi::scatter_input<T>(world, *taskData, storage_a_, 0);
+    local_b_ = ppc::mpi::scatter_input<T>(world, *taskData, storage_b_, 1);
+    return true;
+  }
+
+  bool run() override {
+    internal_order_test();
+    if (summation_ == ppc::core::PLAIN) {
+      T local_res = ppc::core::dot_product(local_a_.data(), local_b_.data(), local_a_.size());
+      boost::mpi::reduce(world, local_res, res_, std::plus<T>(), 0);
+      return true;
+    }
+    auto local_res = ppc::core::compensated_dot_product(local_a_.data(), local_b_.data(), local_a_.size());
+    std::array<T, 2> local_parts = {local_res.sum, local_res.error};
+    if (world.rank() == 0) {
+      std::vector<T> parts(2 * world.size());
+      boost::mpi::gather(world, local_parts.data(), 2, parts.data(), 0);
+      ppc::core::CompensatedSum<T> sum;
+      for (int proc = 0; proc < world.size(); proc++) {
+        sum = sum + ppc::core::CompensatedSum<T>{parts[2 * proc], parts[(2 * proc) + 1]};
+      }
+      res_ = sum.value();
+    } else {
+      boost::mpi::gather(world, local_parts.data(), 2, 0);
+    }
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    if (world.rank() == 0) {
+      reinterpret_cast<T*>(taskData->outputs[0])[0] = res_;
+    }
+    return true;
+  }
+
+ private:
+  ppc::core::Summation summation_;
+  std::vector<T> storage_a_, storage_b_;
+  std::span<const T> local_a_, local_b_;
+  T res_{};
   boost::mpi::communicator world;
 };
 
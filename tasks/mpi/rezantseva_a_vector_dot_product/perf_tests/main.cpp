@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <boost/mpi/timer.hpp>
+#include <cstdint>
 #include <random>
 #include <vector>
 
@@ -26,7 +27,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, test_pipeline_run) {
   std::vector<int> v1 = createRandomVector(count_size_vector);
   std::vector<int> v2 = createRandomVector(count_size_vector);
 
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
   global_vec = {v1, v2};
   // Create TaskData
   std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
@@ -53,7 +54,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, test_pipeline_run) {
   perfAttr->current_timer = [&] { return current_timer.elapsed(); };
   // Create and init perf results
   auto perfResults = std::make_shared<ppc::core::PerfResults>();
-  int answer = rezantseva_a_vector_dot_product_mpi::vectorDotProduct(v1, v2);
+  std::int64_t answer = rezantseva_a_vector_dot_product_mpi::vectorDotProduct(v1, v2);
   //  Create Perf analyzer
   auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
   perfAnalyzer->pipeline_run(perfAttr, perfResults);
@@ -67,7 +68,7 @@ TEST(rezantseva_a_vector_dot_product_mpi, test_pipeline_run) {
 TEST(rezantseva_a_vector_dot_product_mpi, test_task_run) {
   boost::mpi::communicator world;
   std::vector<std::vector<int>> global_vec;
-  std::vector<int32_t> res(1, 0);
+  std::vector<std::int64_t> res(1, 0);
   std::vector<int> v1 = createRandomVector(count_size_vector);
   std::vector<int> v2 = createRandomVector(count_size_vector);
   // Create TaskData
@@ -108,3 +109,41 @@ TEST(rezantseva_a_vector_dot_product_mpi, test_task_run) {
     ASSERT_EQ(rezantseva_a_vector_dot_product_mpi::vectorDotProduct(global_vec[0], global_vec[1]), res[0]);
   }
 }
+
+TEST(rezantseva_a_vector_dot_product_mpi, test_task_run_batched) {
+  boost::mpi::communicator world;
+  // one query vector against many stored ones, the rows stay on their ranks
+  const int rows = 8192;
+  const int cols = 2048;
+  std::vector<int> matrix;
+  std::vector<int> x;
+  std::vector<std::int64_t> res(rows, 0);
+  std::shared_ptr<ppc::core::TaskData> taskDataPar = std::make_shared<ppc::core::TaskData>();
+  if (world.rank() == 0) {
+    matrix = createRandomVector(rows * cols);
+    x = createRandomVector(cols);
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(matrix.data()));
+    taskDataPar->inputs.emplace_back(reinterpret_cast<uint8_t*>(x.data()));
+    taskDataPar->inputs_count.emplace_back(matrix.size());
+    taskDataPar->inputs_count.emplace_back(x.size());
+    taskDataPar->outputs.emplace_back(reinterpret_cast<uint8_t*>(res.data()));
+    taskDataPar->outputs_count.emplace_back(res.size());
+  }
+
+  auto testMpiTaskParallel =
+      std::make_shared<rezantseva_a_vector_dot_product_mpi::BatchedDotProductParallel>(taskDataPar);
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const boost::mpi::timer current_timer;
+  perfAttr->current_timer = [&] { return current_timer.elapsed(); };
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testMpiTaskParallel);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+
+  if (world.rank() == 0) {
+    perfResults->counters["gflops"] = 2.0 * rows * cols * perfAttr->num_running / perfResults->time_sec * 1e-9;
+    ppc::core::Perf::print_perf_statistic(perfResults);
+    std::vector<int> last_row(matrix.end() - cols, matrix.end());
+    ASSERT_EQ(res[rows - 1], rezantseva_a_vector_dot_product_mpi::vectorDotProduct(last_row, x));
+  }
+}
@@ -1,9 +1,13 @@
 // Copyright 2024 Nesterov Alexander
 #include "mpi/rezantseva_a_vector_dot_product/include/ops_mpi.hpp"
 
-int rezantseva_a_vector_dot_product_mpi::vectorDotProduct(const std::vector<int>& v1, const std::vector<int>& v2) {
-  long long result = 0;
-  for (size_t i = 0; i < v1.size(); i++) result += v1[i] * v2[i];
+#include <algorithm>
+#include <array>
+
+std::int64_t rezantseva_a_vector_dot_product_mpi::vectorDotProduct(const std::vector<int>& v1,
+                                                                   const std::vector<int>& v2) {
+  std::int64_t result = 0;
+  for (size_t i = 0; i < v1.size(); i++) result += static_cast<std::int64_t>(v1[i]) * v2[i];
   return result;
 }
 
@@ -34,16 +38,13 @@ bool rezantseva_a_vector_dot_product_mpi::TestMPITaskSequential::pre_processing(
 
 bool rezantseva_a_vector_dot_product_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < input_[0].size(); i++) {
-    res += input_[0][i] * input_[1][i];
-  }
-
+  res = ppc::core::dot_product(input_[0].data(), input_[1].data(), input_[0].size());
   return true;
 }
 
 bool rezantseva_a_vector_dot_product_mpi::TestMPITaskSequential::post_processing() {
   internal_order_test();
-  reinterpret_cast<int*>(taskData->outputs[0])[0] = res;
+  reinterpret_cast<std::int64_t*>(taskData->outputs[0])[0] = res;
   return true;
 }
 
@@ -61,81 +62,100 @@ bool rezantseva_a_vector_dot_product_mpi::TestMPITaskParallel::validation() {
 
 bool rezantseva_a_vector_dot_product_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
+  local_input1_ = ppc::mpi::scatter_input<int>(world, *taskData, storage1_, 0);
+  local_input2_ = ppc::mpi::scatter_input<int>(world, *taskData, storage2_, 1);
+  res = 0;
+  return true;
+}
 
-  size_t total_elements = 0;
-  size_t delta = 0;
-  size_t remainder = 0;
+bool rezantseva_a_vector_dot_product_mpi::TestMPITaskParallel::run() {
+  internal_order_test();
+  // partial sums of large vectors don't fit into int, reduce them as int64
+  std::int64_t local_res = ppc::core::dot_product(local_input1_.data(), local_input2_.data(), local_input1_.size());
+  boost::mpi::reduce(world, local_res, res, std::plus<>(), 0);
+  return true;
+}
 
+bool rezantseva_a_vector_dot_product_mpi::TestMPITaskParallel::post_processing() {
+  internal_order_test();
   if (world.rank() == 0) {
-    total_elements = taskData->inputs_count[0];
-    num_processes_ = world.size();
-    delta = total_elements / num_processes_;      // Calculate base size for each process
-    remainder = total_elements % num_processes_;  // Calculate remaining elements
+    reinterpret_cast<std::int64_t*>(taskData->outputs[0])[0] = res;
   }
-  boost::mpi::broadcast(world, num_processes_, 0);
-
-  counts_.resize(num_processes_);  // Vector to store counts for each process
+  return true;
+}
 
-  if (world.rank() == 0) {
-    // Distribute sizes to each process
-    for (unsigned int i = 0; i < num_processes_; ++i) {
-      counts_[i] = delta + (i < remainder ? 1 : 0);  // Assign 1 additional element to the first 'remainder' processes
-    }
+bool rezantseva_a_vector_dot_product_mpi::BatchedDotProductParallel::validation() {
+  internal_order_test();
+  if (world.rank() != 0) {
+    return true;
   }
-  boost::mpi::broadcast(world, counts_.data(), num_processes_, 0);
+  if (taskData->inputs.size() != 2 || taskData->inputs_count.size() != 2 || taskData->outputs.size() != 1 ||
+      taskData->outputs_count.size() != 1 || taskData->outputs_count[0] == 0) {
+    return false;
+  }
+  auto rows = taskData->outputs_count[0];
+  auto cols = taskData->inputs_count[0] / rows;
+  return taskData->inputs_count[0] % rows == 0 &&
+         (taskData->inputs_count[1] == cols || taskData->inputs_count[1] == taskData->inputs_count[0]);
+}
 
+bool rezantseva_a_vector_dot_product_mpi::BatchedDotProductParallel::pre_processing() {
+  internal_order_test();
+  std::array<std::uint64_t, 3> shape{};
+  const int* matrix = nullptr;
+  const int* other = nullptr;
   if (world.rank() == 0) {
-    input_ = std::vector<std::vector<int>>(taskData->inputs.size());
-    for (size_t i = 0; i < input_.size(); i++) {
-      auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[i]);
-      input_[i] = std::vector<int>(taskData->inputs_count[i]);
-      for (size_t j = 0; j < taskData->inputs_count[i]; j++) {
-        input_[i][j] = tmp_ptr[j];
-      }
+    shape[0] = taskData->outputs_count[0];
+    shape[1] = taskData->inputs_count[0] / shape[0];
+    shape[2] = shape[0] > 1 && taskData->inputs_count[1] == taskData->inputs_count[0] ? 1 : 0;
+    matrix = reinterpret_cast<const int*>(taskData->inputs[0]);
+    other = reinterpret_cast<const int*>(taskData->inputs[1]);
+  }
+  boost::mpi::broadcast(world, shape.data(), 3, 0);
+  rows_ = shape[0];
+  cols_ = shape[1];
+  pairs_ = shape[2] != 0;
+
+  auto blocks = ppc::mpi::row_block_partition(rows_, cols_, world.size());
+  local_matrix_ = ppc::mpi::scatter_view(world, matrix, blocks, matrix_storage_);
+  if (pairs_) {
+    local_other_ = ppc::mpi::scatter_view(world, other, blocks, other_storage_);
+  } else {
+    // the shared vector is read by every row, each rank keeps a copy
+    if (world.rank() == 0) {
+      other_storage_.assign(other, other + cols_);
+    } else {
+      other_storage_.resize(cols_);
     }
+    boost::mpi::broadcast(world, other_storage_.data(), static_cast<int>(cols_), 0);
+    local_other_ = other_storage_;
   }
-
-  res = 0;
   return true;
 }
 
-bool rezantseva_a_vector_dot_product_mpi::TestMPITaskParallel::run() {
+bool rezantseva_a_vector_dot_product_mpi::BatchedDotProductParallel::run() {
   internal_order_test();
-
-  if (world.rank() == 0) {
-    size_t offset_remainder = counts_[0];
-    for (unsigned int proc = 1; proc < num_processes_; proc++) {
-      size_t current_count = counts_[proc];
-      world.send(proc, 0, input_[0].data() + offset_remainder, current_count);
-      world.send(proc, 1, input_[1].data() + offset_remainder, current_count);
-      offset_remainder += current_count;
+  ppc::mpi::BlockPartition row_blocks(static_cast<int>(rows_), world.size());
+  std::size_t local_rows = row_blocks.count(world.rank());
+  std::vector<std::int64_t> local_res(local_rows);
+  if (pairs_) {
+    for (std::size_t r = 0; r < local_rows; r++) {
+      std::size_t offset = r * cols_;
+      local_res[r] = ppc::core::dot_product(local_matrix_.data() + offset, local_other_.data() + offset, cols_);
     }
-  }
-
-  local_input1_ = std::vector<int>(counts_[world.rank()]);
-  local_input2_ = std::vector<int>(counts_[world.rank()]);
-
-  if (world.rank() > 0) {
-    world.recv(0, 0, local_input1_.data(), counts_[world.rank()]);
-    world.recv(0, 1, local_input2_.data(), counts_[world.rank()]);
   } else {
-    local_input1_ = std::vector<int>(input_[0].begin(), input_[0].begin() + counts_[0]);
-    local_input2_ = std::vector<int>(input_[1].begin(), input_[1].begin() + counts_[0]);
+    ppc::core::batched_dot_product(local_matrix_.data(), local_rows, cols_, cols_, local_other_.data(),
+                                   local_res.data());
   }
-
-  int local_res = 0;
-
-  for (size_t i = 0; i < local_input1_.size(); i++) {
-    local_res += local_input1_[i] * local_input2_[i];
-  }
-  boost::mpi::reduce(world, local_res, res, std::plus<>(), 0);
+  ppc::mpi::gather_result<std::int64_t>(world, *taskData, local_res, row_blocks, res_);
   return true;
 }
 
-bool rezantseva_a_vector_dot_product_mpi::TestMPITaskParallel::post_processing() {
+bool rezantseva_a_vector_dot_product_mpi::BatchedDotProductParallel::post_processing() {
   internal_order_test();
-  if (world.rank() == 0) {
-    reinterpret_cast<int*>(taskData->outputs[0])[0] = res;
+  // res_ is empty on ranks that don't get the result
+  if (!res_.empty()) {
+    std::copy(res_.begin(), res_.end(), reinterpret_cast<std::int64_t*>(taskData->outputs[0]));
   }
   return true;
 }
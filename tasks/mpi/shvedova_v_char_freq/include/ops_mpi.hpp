@@ -10,7 +10,9 @@
 #include <utility>
 #include <vector>
 
+#include "core/simd/include/text_scan.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/text_scan/include/text_scan.hpp"
 
 namespace shvedova_v_char_freq_mpi {
 
@@ -42,10 +44,8 @@ class CharFrequencyParallel : public ppc::core::Task {
 
  private:
   std::vector<char> input_str_;
-  std::vector<char> local_input_;
   char target_char_;
   int res{};
-  int local_res{};
 
   boost::mpi::communicator world;
 };
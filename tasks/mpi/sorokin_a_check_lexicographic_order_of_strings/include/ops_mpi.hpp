@@ -7,11 +7,14 @@
 #include <boost/mpi/communicator.hpp>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/scatter/include/scatter.hpp"
 
 namespace sorokin_a_check_lexicographic_order_of_strings_mpi {
 
@@ -24,7 +27,7 @@ class TestMPITaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<char>> input_;
+  ppc::core::Matrix<char> input_;
   int res_{};
 };
 
@@ -37,8 +40,9 @@ class TestMPITaskParallel : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<char>> input_;
-  std::vector<char> local_input1_, local_input2_;
+  ppc::core::Matrix<char> input_;
+  std::vector<char> storage1_, storage2_;
+  std::span<const char> local_input1_, local_input2_;
   int res_{};
   boost::mpi::communicator world;
 };
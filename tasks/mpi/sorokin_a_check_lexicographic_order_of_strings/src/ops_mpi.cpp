@@ -2,6 +2,7 @@
 #include "mpi/sorokin_a_check_lexicographic_order_of_strings/include/ops_mpi.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <random>
 #include <string>
@@ -12,14 +13,7 @@ using namespace std::chrono_literals;
 
 bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskSequential::pre_processing() {
   internal_order_test();
-  input_ = std::vector<std::vector<char>>(taskData->inputs_count[0], std::vector<char>(taskData->inputs_count[1]));
-
-  for (unsigned int i = 0; i < taskData->inputs_count[0]; i++) {
-    auto* tmp_ptr = reinterpret_cast<char*>(taskData->inputs[i]);
-    for (unsigned int j = 0; j < taskData->inputs_count[1]; j++) {
-      input_[i][j] = tmp_ptr[j];
-    }
-  }
+  input_ = ppc::core::matrix_from_rows<char>(*taskData, taskData->inputs_count[0], taskData->inputs_count[1]);
   res_ = 0;
   return true;
 }
@@ -31,12 +25,12 @@ bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskSequential::
 
 bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < std::min(input_[0].size(), input_[1].size()); ++i) {
-    if (static_cast<int>(input_[0][i]) > static_cast<int>(input_[1][i])) {
+  for (size_t i = 0; i < input_.cols(); ++i) {
+    if (static_cast<int>(input_(0, i)) > static_cast<int>(input_(1, i))) {
       res_ = 1;
       break;
     }
-    if (static_cast<int>(input_[0][i]) < static_cast<int>(input_[1][i])) {
+    if (static_cast<int>(input_(0, i)) < static_cast<int>(input_(1, i))) {
       break;
     }
   }
@@ -51,37 +45,18 @@ bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskSequential::
 
 bool sorokin_a_check_lexicographic_order_of_strings_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
-  unsigned int delta = 0;
-  unsigned int remainder = 0;
-  if (world.rank() == 0) {
-    delta = taskData->inputs_count[1] / world.size();
-    remainder = taskData->inputs_count[1] % world.size();
-  }
-  broadcast(world, delta, 0);
-
-  if (world.rank() == 0) {
-    input_ = std::vector<std::vector<char>>(taskData->inputs_count[0], std::vector<char>(taskData->inputs_count[1]));
-
-    for (unsigned int i = 0; i < taskData->inputs_count[0]; i++) {
-      auto* tmp_ptr = reinterpret_cast<char*>(taskData->inputs[i]);
-      for (unsigned int j = 0; j < taskData->inputs_count[1]; j++) {
-        input_[i][j] = tmp_ptr[j];
-      }
-    }
-    for (int proc = 1; proc < world.size(); proc++) {
-      world.send(proc, 0, input_[0].data() + delta * proc + remainder, delta);
-      world.send(proc, 1, input_[1].data() + delta * proc + remainder, delta);
-    }
-  }
-  local_input1_ = std::vector<char>(delta);
-  local_input2_ = std::vector<char>(delta);
+  std::uint64_t cols = 0;
   if (world.rank() == 0) {
-    local_input1_ = std::vector<char>(input_[0].begin(), input_[0].begin() + delta + remainder);
-    local_input2_ = std::vector<char>(input_[1].begin(), input_[1].begin() + delta + remainder);
-  } else {
-    world.recv(0, 0, local_input1_.data(), delta);
-    world.recv(0, 1, local_input2_.data(), delta);
+    cols = taskData->inputs_count[1];
+    input_ = ppc::core::matrix_from_rows<char>(*taskData, taskData->inputs_count[0], cols);
   }
+  broadcast(world, cols, 0);
+  // both strings are split the same way, straight from the rows of input_
+  ppc::mpi::LargeBlockPartition partition(cols, world.size());
+  local_input1_ = ppc::mpi::scatter_view(world, world.rank() == 0 ? input_.row(0).data() : nullptr, partition,
+                                         storage1_);
+  local_input2_ = ppc::mpi::scatter_view(world, world.rank() == 0 ? input_.row(1).data() : nullptr, partition,
+                                         storage2_);
   res_ = 2;
   return true;
 }
@@ -5,11 +5,16 @@
 #include <boost/mpi/communicator.hpp>
 #include <memory>
 #include <numeric>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
+#include "mpi_core/partition/include/partition.hpp"
+#include "mpi_core/shared_window/include/shared_window.hpp"
+#include "mpi_core/topology/include/topology.hpp"
 
 namespace sotskov_a_sum_element_matrix_mpi {
 
@@ -45,15 +50,16 @@ class TestMPITaskParallel : public ppc::core::Task {
   void set_matrix(const std::vector<double>& matrix, int rows, int cols);
 
  private:
-  double parallel_sum_elements(const std::vector<double>& matrix);
+  static double parallel_sum_elements(std::span<const double> matrix);
 
-  std::vector<double> matrix_;
+  std::unique_ptr<ppc::mpi::SharedWindow<double>> matrix_;
   int rows_{};
   int cols_{};
   double local_result_{};
   double global_result_{};
 
   boost::mpi::communicator world;
+  ppc::mpi::NodeTopology topology{world};
 };
 
 }  // namespace sotskov_a_sum_element_matrix_mpi
\ No newline at end of file
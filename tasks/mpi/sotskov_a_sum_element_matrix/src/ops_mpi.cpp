@@ -4,7 +4,6 @@
 #include <boost/mpi.hpp>
 #include <chrono>
 #include <functional>
-#include <numeric>
 #include <random>
 #include <string>
 #include <thread>
@@ -30,7 +29,7 @@ bool sotskov_a_sum_element_matrix_mpi::TestMPITaskSequential::validation() {
 
 bool sotskov_a_sum_element_matrix_mpi::TestMPITaskSequential::run() {
   internal_order_test();
-  result_ = std::accumulate(matrix_.begin(), matrix_.end(), 0.0);
+  result_ = ppc::core::reduce_elements<ppc::core::SUM, double>(matrix_.data(), matrix_.size());
   return true;
 }
 
@@ -43,20 +42,18 @@ bool sotskov_a_sum_element_matrix_mpi::TestMPITaskSequential::post_processing()
 bool sotskov_a_sum_element_matrix_mpi::TestMPITaskParallel::pre_processing() {
   internal_order_test();
 
+  const double* tmp_ptr_matrix = nullptr;
   if (world.rank() == 0) {
-    auto* tmp_ptr_matrix = reinterpret_cast<double*>(taskData->inputs[0]);
-    auto* tmp_ptr_rows = reinterpret_cast<int*>(taskData->inputs[1]);
-    auto* tmp_ptr_cols = reinterpret_cast<int*>(taskData->inputs[2]);
-    matrix_.assign(tmp_ptr_matrix, tmp_ptr_matrix + (*tmp_ptr_rows) * (*tmp_ptr_cols));
-    rows_ = *tmp_ptr_rows;
-    cols_ = *tmp_ptr_cols;
+    tmp_ptr_matrix = reinterpret_cast<double*>(taskData->inputs[0]);
+    rows_ = *reinterpret_cast<int*>(taskData->inputs[1]);
+    cols_ = *reinterpret_cast<int*>(taskData->inputs[2]);
   }
   broadcast(world, rows_, 0);
   broadcast(world, cols_, 0);
-  if (world.rank() != 0) {
-    matrix_.resize(rows_ * cols_);
-  }
-  broadcast(world, matrix_.data(), matrix_.size(), 0);
+
+  // every rank reads only its own block, one copy of it per node
+  ppc::mpi::BlockPartition partition(rows_ * cols_, world.size());
+  matrix_ = std::make_unique<ppc::mpi::SharedWindow<double>>(topology, tmp_ptr_matrix, partition.counts);
   return true;
 }
 
@@ -70,7 +67,7 @@ bool sotskov_a_sum_element_matrix_mpi::TestMPITaskParallel::validation() {
 
 bool sotskov_a_sum_element_matrix_mpi::TestMPITaskParallel::run() {
   internal_order_test();
-  local_result_ = parallel_sum_elements(matrix_);
+  local_result_ = parallel_sum_elements(matrix_->local());
   reduce(world, local_result_, global_result_, std::plus<>(), 0);
   return true;
 }
@@ -83,24 +80,6 @@ bool sotskov_a_sum_element_matrix_mpi::TestMPITaskParallel::post_processing() {
   return true;
 }
 
-double sotskov_a_sum_element_matrix_mpi::TestMPITaskParallel::parallel_sum_elements(const std::vector<double>& matrix) {
-  int rank = world.rank();
-  int size = world.size();
-  int total_elements = matrix.size();
-
-  int base_elements_per_process = total_elements / size;
-  int remainder = total_elements % size;
-
-  int start_idx = rank * base_elements_per_process + std::min(rank, remainder);
-  int end_idx = start_idx + base_elements_per_process + (rank < remainder ? 1 : 0);
-
-  double local_sum = 0.0;
-  for (int i = start_idx; i < end_idx; ++i) {
-    local_sum += matrix[i];
-  }
-
-  double global_sum = 0.0;
-  MPI_Reduce(&local_sum, &global_sum, 1, MPI_DOUBLE, MPI_SUM, 0, world);
-
-  return global_sum;
+double sotskov_a_sum_element_matrix_mpi::TestMPITaskParallel::parallel_sum_elements(std::span<const double> matrix) {
+  return ppc::core::reduce_elements<ppc::core::SUM, double>(matrix.data(), matrix.size());
 }
@@ -2,6 +2,8 @@
 #include <numeric>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace chistov_a_sum_of_matrix_elements_seq {
@@ -41,7 +43,7 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<T> input_;
+  ppc::core::Matrix<T> input_;
   T res{};
 };
 
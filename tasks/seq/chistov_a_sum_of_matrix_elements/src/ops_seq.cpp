@@ -6,8 +6,8 @@ template <typename T>
 bool TestTaskSequential<T>::pre_processing() {
   internal_order_test();
 
-  T* tmp_ptr = reinterpret_cast<T*>(taskData->inputs[0]);
-  input_.assign(tmp_ptr, tmp_ptr + taskData->inputs_count[0]);
+  // the flat input as a 1 x n matrix, without a copy
+  input_ = ppc::core::matrix_from_input<T>(*taskData, 0, 1, taskData->inputs_count[0]);
   return true;
 }
 
@@ -22,7 +22,9 @@ template <typename T>
 bool TestTaskSequential<T>::run() {
   internal_order_test();
 
-  res = std::accumulate(input_.begin(), input_.end(), 0);
+  std::vector<T> total;
+  ppc::core::reduce_matrix<ppc::core::SUM>(input_, ppc::core::TOTAL, total);
+  res = total[0];
   return true;
 }
 
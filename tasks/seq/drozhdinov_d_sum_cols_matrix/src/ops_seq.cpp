@@ -3,20 +3,16 @@
 
 #include <thread>
 
+#include "core/simd/include/column_sums.hpp"
+
 using namespace std::chrono_literals;
 
 int makeLinCoords(int x, int y, int xSize) { return y * xSize + x; }
 
 std::vector<int> calcMatrixSumSeq(const std::vector<int>& matrix, int xSize, int ySize, int fromX, int toX) {
-  std::vector<int> result;
-  for (int x = fromX; x < toX; x++) {
-    int columnSum = 0;
-    for (int y = 0; y < ySize; y++) {
-      int linearizedCoordinate = makeLinCoords(x, y, xSize);
-      columnSum += matrix[linearizedCoordinate];
-    }
-    result.push_back(columnSum);
-  }
+  // rows are streamed in memory order instead of walking down every column
+  std::vector<int> result(toX - fromX, 0);
+  ppc::core::add_column_sums(matrix.data() + fromX, ySize, result.size(), xSize, result.data());
   return result;
 }
 
@@ -157,3 +157,38 @@ TEST(ermolaev_v_min_matrix_seq, test_min_100x100) {
 
   ASSERT_EQ(ref, out[0]);
 }
+
+TEST(ermolaev_v_min_matrix_seq, test_min_position_10x20) {
+  const int count_rows = 10;
+  const int count_columns = 20;
+
+  // Create data
+  std::vector<int> out(1, INT_MAX);
+  std::vector<uint64_t> out_index(1, 0);
+  std::vector<std::vector<int>> in = ermolaev_v_min_matrix_seq::getRandomMatrix(count_rows, count_columns, 0, 500);
+  // the first of equal minima in row-major order
+  in[8][1] = -3;
+  in[4][15] = -3;
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  for (unsigned int i = 0; i < in.size(); i++)
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in[i].data()));
+  taskDataSeq->inputs_count.emplace_back(count_rows);
+  taskDataSeq->inputs_count.emplace_back(count_columns);
+
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out_index.data()));
+  taskDataSeq->outputs_count.emplace_back(out_index.size());
+
+  // Create Task
+  ermolaev_v_min_matrix_seq::TestTaskSequential testTaskSequential(taskDataSeq);
+  ASSERT_EQ(testTaskSequential.validation(), true);
+  testTaskSequential.pre_processing();
+  testTaskSequential.run();
+  testTaskSequential.post_processing();
+
+  ASSERT_EQ(-3, out[0]);
+  ASSERT_EQ(static_cast<uint64_t>((4 * count_columns) + 15), out_index[0]);
+}
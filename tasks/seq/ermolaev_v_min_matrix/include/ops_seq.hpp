@@ -1,10 +1,13 @@
 // Copyright 2023 Nesterov Alexander
 #pragma once
 
+#include <cstdint>
 #include <limits>
 #include <string>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace ermolaev_v_min_matrix_seq {
@@ -21,8 +24,10 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<int>> input_;
+  ppc::core::Matrix<int> input_;
   int res_{};
+  // row-major position i * columns + j of the minimum
+  std::uint64_t res_index_{};
 };
 
 }  // namespace ermolaev_v_min_matrix_seq
\ No newline at end of file
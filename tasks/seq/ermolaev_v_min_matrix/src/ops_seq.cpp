@@ -28,14 +28,7 @@ std::vector<std::vector<int>> ermolaev_v_min_matrix_seq::getRandomMatrix(int row
 bool ermolaev_v_min_matrix_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
   // Init vectors
-  input_ = std::vector<std::vector<int>>(taskData->inputs_count[0], std::vector<int>(taskData->inputs_count[1]));
-
-  for (unsigned int i = 0; i < taskData->inputs_count[0]; i++) {
-    auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[i]);
-    for (unsigned int j = 0; j < taskData->inputs_count[1]; j++) {
-      input_[i][j] = tmp_ptr[j];
-    }
-  }
+  input_ = ppc::core::matrix_from_rows<int>(*taskData, taskData->inputs_count[0], taskData->inputs_count[1]);
 
   // Init value for output
   res_ = INT_MAX;
@@ -44,24 +37,24 @@ bool ermolaev_v_min_matrix_seq::TestTaskSequential::pre_processing() {
 
 bool ermolaev_v_min_matrix_seq::TestTaskSequential::validation() {
   internal_order_test();
-  // Check count elements of output
-  return taskData->inputs_count[0] > 0 && taskData->inputs_count[1] > 0 && taskData->outputs_count[0] == 1;
+  // Check count elements of output, the position of the minimum is optional
+  return taskData->inputs_count[0] > 0 && taskData->inputs_count[1] > 0 && taskData->outputs_count[0] == 1 &&
+         (taskData->outputs_count.size() < 2 || taskData->outputs_count[1] == 1);
 }
 
 bool ermolaev_v_min_matrix_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < input_.size(); i++) {
-    for (size_t j = 0; j < input_[i].size(); j++) {
-      if (input_[i][j] < res_) {
-        res_ = input_[i][j];
-      }
-    }
-  }
+  auto min = ppc::core::arg_reduce_matrix<ppc::core::MIN>(input_);
+  res_ = min.value;
+  res_index_ = min.index;
   return true;
 }
 
 bool ermolaev_v_min_matrix_seq::TestTaskSequential::post_processing() {
   internal_order_test();
   reinterpret_cast<int*>(taskData->outputs[0])[0] = res_;
+  if (taskData->outputs.size() > 1) {
+    reinterpret_cast<std::uint64_t*>(taskData->outputs[1])[0] = res_index_;
+  }
   return true;
 }
@@ -5,6 +5,8 @@
 #include <string>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace filatev_v_sum_of_matrix_elements_seq {
@@ -21,7 +23,7 @@ class SumMatrix : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> matrix;
+  ppc::core::Matrix<int> matrix;
   long long summ = 0;
   int size_n, size_m;
 };
@@ -7,15 +7,7 @@ bool filatev_v_sum_of_matrix_elements_seq::SumMatrix::pre_processing() {
   summ = 0;
   size_n = taskData->inputs_count[0];
   size_m = taskData->inputs_count[1];
-  matrix = std::vector<int>(size_m * size_n);
-
-  for (int i = 0; i < size_m; ++i) {
-    auto* temp = reinterpret_cast<int*>(taskData->inputs[i]);
-
-    for (int j = 0; j < size_n; ++j) {
-      matrix[i * size_n + j] = temp[j];
-    }
-  }
+  matrix = ppc::core::matrix_from_rows<int>(*taskData, size_m, size_n);
 
   return true;
 }
@@ -29,9 +21,9 @@ bool filatev_v_sum_of_matrix_elements_seq::SumMatrix::validation() {
 bool filatev_v_sum_of_matrix_elements_seq::SumMatrix::run() {
   internal_order_test();
 
-  for (long unsigned int i = 0; i < matrix.size(); ++i) {
-    summ += matrix[i];
-  }
+  std::vector<long long> total;
+  ppc::core::reduce_matrix<ppc::core::SUM>(matrix, ppc::core::TOTAL, total);
+  summ = total[0];
 
   return true;
 }
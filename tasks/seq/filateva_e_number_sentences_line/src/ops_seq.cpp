@@ -20,12 +20,10 @@ bool filateva_e_number_sentences_line_seq::NumberSentencesLine::validation() {
 
 bool filateva_e_number_sentences_line_seq::NumberSentencesLine::run() {
   internal_order_test();
-  for (long unsigned int i = 0; i < line.size(); ++i) {
-    if (line[i] == '.' || line[i] == '?' || line[i] == '!') {
-      ++sentence_count;
-    }
-  }
-  if (!line.empty() && line.back() != '.' && line.back() != '?' && line.back() != '!') {
+  auto counts = ppc::core::scan_text(line.data(), line.size());
+  sentence_count = static_cast<int>(counts.terminators);
+  // the last sentence may have no terminator
+  if (counts.bytes > 0 && (counts.last & ppc::core::TERMINATOR) == 0) {
     ++sentence_count;
   }
   return true;
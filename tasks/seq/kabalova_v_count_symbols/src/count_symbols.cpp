@@ -8,13 +8,7 @@
 using namespace std::chrono_literals;
 
 int kabalova_v_count_symbols_seq::countSymbols(std::string& str) {
-  int result = 0;
-  for (size_t i = 0; i < str.size(); i++) {
-    if (isalpha(str[i]) != 0) {
-      result++;
-    }
-  }
-  return result;
+  return static_cast<int>(ppc::core::scan_text(str.data(), str.size()).letters);
 }
 
 bool kabalova_v_count_symbols_seq::TestTaskSequential::pre_processing() {
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "core/simd/include/text_scan.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kolodkin_g_sentence_count_seq {
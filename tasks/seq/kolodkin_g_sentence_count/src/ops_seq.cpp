@@ -19,12 +19,8 @@ bool kolodkin_g_sentence_count_seq::TestTaskSequential::validation() {
 
 bool kolodkin_g_sentence_count_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (unsigned long i = 0; i < input_.length(); i++) {
-    if ((input_[i] == '.' || input_[i] == '!' || input_[i] == '?') &&
-        ((input_[i + 1] != '.' && input_[i + 1] != '!' && input_[i + 1] != '?') || i + 1 == input_.length())) {
-      res++;
-    }
-  }
+  // a sentence ends with a run of terminators, "Well..." is one
+  res = static_cast<int>(ppc::core::scan_text(input_.data(), input_.size()).sentences);
   return true;
 }
 
@@ -2,7 +2,10 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <span>
 #include <vector>
 
 #include "seq/korablev_v_rect_int_seq/include/ops_seq.hpp"
@@ -143,4 +146,133 @@ TEST(korablev_v_rectangular_integration_seq, test_set_function) {
   double x = 2.0;
   double expected_result = 4.0;
   ASSERT_EQ(func(x), expected_result);
-}
\ No newline at end of file
+}
+
+TEST(korablev_v_rectangular_integration_seq, test_inline_integrand_matches_std_function) {
+  const double a = -1.0;
+  const double b = 2.0;
+  const int n = 1003;
+
+  auto integrate = [&](auto&& set) {
+    std::vector<double> in = {a, b, static_cast<double>(n)};
+    std::vector<double> out(1, 0.0);
+
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataSeq->inputs_count.emplace_back(in.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskDataSeq->outputs_count.emplace_back(out.size());
+
+    korablev_v_rect_int_seq::RectangularIntegrationSequential testTaskSequential(taskDataSeq);
+    set(testTaskSequential);
+    testTaskSequential.validation();
+    testTaskSequential.pre_processing();
+    testTaskSequential.run();
+    testTaskSequential.post_processing();
+    return out[0];
+  };
+
+  std::function<double(double)> func = [](double x) { return std::exp(x) * std::cos(x); };
+  double erased = integrate([&](auto& task) { task.set_function(func); });
+  double inlined = integrate([](auto& task) { task.set_function([](double x) { return std::exp(x) * std::cos(x); }); });
+
+  ASSERT_NEAR(erased, inlined, 1e-12);
+}
+
+TEST(korablev_v_rectangular_integration_seq, test_adaptive_integration_to_tolerance) {
+  const double a = 0.0;
+  const double b = 1.0;
+  const double tolerance = 1e-10;
+
+  for (auto rule : {ppc::core::SIMPSON, ppc::core::GAUSS_KRONROD_15}) {
+    std::vector<double> in = {a, b, tolerance};
+    std::vector<double> out(1, 0.0);
+
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+    taskDataSeq->inputs_count.emplace_back(in.size());
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskDataSeq->outputs_count.emplace_back(out.size());
+
+    korablev_v_rect_int_seq::AdaptiveIntegrationSequential testTaskSequential(taskDataSeq, rule);
+    // steep near 0, refined there only
+    testTaskSequential.set_function([](double x) { return std::sqrt(x) * std::cos(x); });
+
+    ASSERT_TRUE(testTaskSequential.validation());
+    testTaskSequential.pre_processing();
+    testTaskSequential.run();
+    testTaskSequential.post_processing();
+
+    EXPECT_NEAR(out[0], 0.531202683085, 1e-9);
+    EXPECT_LE(testTaskSequential.result().error, tolerance);
+    EXPECT_GT(testTaskSequential.result().evaluations, 0);
+  }
+}
+
+TEST(korablev_v_rectangular_integration_seq, test_adaptive_integration_rejects_zero_tolerance) {
+  std::vector<double> in = {0.0, 1.0, 0.0};
+  std::vector<double> out(1, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskDataSeq->inputs_count.emplace_back(in.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  korablev_v_rect_int_seq::AdaptiveIntegrationSequential testTaskSequential(taskDataSeq);
+  ASSERT_FALSE(testTaskSequential.validation());
+}
+
+TEST(korablev_v_rectangular_integration_seq, test_multidim_integration) {
+  std::vector<double> lower = {0.0, 0.0, 0.0, 0.0};
+  std::vector<double> upper = {1.0, 1.0, 2.0, 0.5};
+  const double expected_result = std::sin(1.0) * std::sin(1.0) * std::sin(2.0) * std::sin(0.5);
+
+  for (auto method : {ppc::core::TENSOR_GRID, ppc::core::HALTON, ppc::core::SOBOL}) {
+    std::uint64_t points = method == ppc::core::TENSOR_GRID ? 20 : 4096;
+    std::vector<double> out(1, 0.0);
+
+    std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(lower.data()));
+    taskDataSeq->inputs_count.emplace_back(lower.size());
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(upper.data()));
+    taskDataSeq->inputs_count.emplace_back(upper.size());
+    taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&points));
+    taskDataSeq->inputs_count.emplace_back(1);
+    taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+    taskDataSeq->outputs_count.emplace_back(out.size());
+
+    korablev_v_rect_int_seq::MultidimIntegrationSequential testTaskSequential(taskDataSeq, method);
+    testTaskSequential.set_function([](std::span<const double> x) {
+      return std::cos(x[0]) * std::cos(x[1]) * std::cos(x[2]) * std::cos(x[3]);
+    });
+
+    ASSERT_TRUE(testTaskSequential.validation());
+    testTaskSequential.pre_processing();
+    testTaskSequential.run();
+    testTaskSequential.post_processing();
+
+    EXPECT_NEAR(out[0], expected_result, 1e-3);
+    EXPECT_LE(std::abs(out[0] - expected_result), 5 * testTaskSequential.result().error);
+  }
+}
+
+TEST(korablev_v_rectangular_integration_seq, test_multidim_integration_rejects_odd_grid) {
+  std::vector<double> lower = {0.0, 0.0};
+  std::vector<double> upper = {1.0, 1.0};
+  std::uint64_t points = 15;
+  std::vector<double> out(1, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(lower.data()));
+  taskDataSeq->inputs_count.emplace_back(lower.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(upper.data()));
+  taskDataSeq->inputs_count.emplace_back(upper.size());
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(&points));
+  taskDataSeq->inputs_count.emplace_back(1);
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  korablev_v_rect_int_seq::MultidimIntegrationSequential testTaskSequential(taskDataSeq, ppc::core::TENSOR_GRID);
+  ASSERT_FALSE(testTaskSequential.validation());
+}
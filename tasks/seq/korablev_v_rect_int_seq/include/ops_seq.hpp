@@ -1,7 +1,14 @@
 #pragma once
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
+#include <utility>
+#include <vector>
 
+#include "core/integration/include/adaptive_quadrature.hpp"
+#include "core/integration/include/cubature.hpp"
+#include "core/integration/include/integration.hpp"
 #include "core/task/include/task.hpp"
 
 namespace korablev_v_rect_int_seq {
@@ -16,16 +23,84 @@ class RectangularIntegrationSequential : public ppc::core::Task {
   bool run() override;
   bool post_processing() override;
 
+  // type-erased integrand, called indirectly for every point
   void set_function(const std::function<double(double)>& func);
+  // any other callable is inlined into the sum and evaluated in batches
+  template <ppc::core::Integrand F>
+  void set_function(F func) {
+    sum_ = ppc::core::make_range_sum(std::move(func), 0.5);
+  }
 
  private:
-  static double integrate(const std::function<double(double)>& f, double a, double b, int n);
-
   double a_{};
   double b_{};
   int n_{};
   double result_{};
-  std::function<double(double)> func_;
+  ppc::core::RangeSum sum_;
+};
+
+// Integral over [a, b] to an absolute tolerance, refining only where the
+// error estimate of `rule` demands it; inputs[0] = {a, b, tolerance}.
+class AdaptiveIntegrationSequential : public ppc::core::Task {
+ public:
+  explicit AdaptiveIntegrationSequential(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                         ppc::core::QuadratureRule rule = ppc::core::GAUSS_KRONROD_15)
+      : Task(std::move(taskData_)), rule_(rule) {}
+
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  void set_function(const std::function<double(double)>& func);
+  template <ppc::core::Integrand F>
+  void set_function(F func) {
+    integral_ = ppc::core::make_adaptive_integral(std::move(func), rule_);
+  }
+
+  // value, error estimate and evaluations of the last run
+  [[nodiscard]] const ppc::core::QuadratureResult& result() const { return result_; }
+
+ private:
+  ppc::core::QuadratureRule rule_;
+  double a_{};
+  double b_{};
+  double tolerance_{};
+  ppc::core::QuadratureResult result_;
+  ppc::core::AdaptiveIntegral integral_;
+};
+
+// Integral over the box [lower, upper] in several dimensions with a
+// tensor grid or randomized quasi-Monte Carlo; inputs[0] and inputs[1]
+// are the lower and upper bounds, inputs[2] the std::uint64_t number of
+// points (per dimension for the grid, per replica otherwise).
+class MultidimIntegrationSequential : public ppc::core::Task {
+ public:
+  explicit MultidimIntegrationSequential(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                         ppc::core::CubatureMethod method = ppc::core::SOBOL)
+      : Task(std::move(taskData_)), method_(method) {}
+
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+  void set_function(const std::function<double(std::span<const double>)>& func);
+  template <ppc::core::MultiIntegrand F>
+  void set_function(F func) {
+    items_ = ppc::core::make_cubature_items(std::move(func));
+  }
+
+  // value, error estimate and evaluations of the last run
+  [[nodiscard]] const ppc::core::QuadratureResult& result() const { return result_; }
+
+ private:
+  ppc::core::CubatureMethod method_;
+  std::vector<double> lower_;
+  std::vector<double> upper_;
+  std::uint64_t points_{};
+  ppc::core::QuadratureResult result_;
+  ppc::core::CubatureItems items_;
 };
 
 }  // namespace korablev_v_rect_int_seq
\ No newline at end of file
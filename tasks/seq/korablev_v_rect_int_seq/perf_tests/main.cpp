@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -50,7 +51,7 @@ TEST(korablev_v_rect_int_seq, test_pipeline_run) {
 TEST(korablev_v_rect_int_seq, test_task_run) {
   const double a = 0.0;
   const double b = 1.0;
-  const int n = 10000;
+  const int n = 100000000;
   const double expected_result = 1.0 / 3.0;
 
   std::vector<double> in = {a, b, static_cast<double>(n)};
@@ -82,7 +83,89 @@ TEST(korablev_v_rect_int_seq, test_task_run) {
 
   perfAnalyzer->task_run(perfAttr, perfResults);
 
+  perfResults->counters["samples_per_sec"] = static_cast<double>(n) * perfAttr->num_running / perfResults->time_sec;
+  ppc::core::Perf::print_perf_statistic(perfResults);
+
+  ASSERT_NEAR(out[0], expected_result, 1e-3);
+}
+
+TEST(korablev_v_rect_int_seq, test_task_run_inline_integrand) {
+  const double a = 0.0;
+  const double b = 1.0;
+  const int n = 100000000;
+  const double expected_result = 1.0 / 3.0;
+
+  std::vector<double> in = {a, b, static_cast<double>(n)};
+  std::vector<double> out(1, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskDataSeq->inputs_count.emplace_back(in.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  auto testTaskSequential = std::make_shared<korablev_v_rect_int_seq::RectangularIntegrationSequential>(taskDataSeq);
+
+  // inlined into the sum instead of called through std::function
+  testTaskSequential->set_function([](double x) { return x * x; });
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perfAttr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testTaskSequential);
+
+  perfAnalyzer->task_run(perfAttr, perfResults);
+
+  perfResults->counters["samples_per_sec"] = static_cast<double>(n) * perfAttr->num_running / perfResults->time_sec;
   ppc::core::Perf::print_perf_statistic(perfResults);
 
   ASSERT_NEAR(out[0], expected_result, 1e-3);
 }
+
+TEST(korablev_v_rect_int_seq, test_task_run_adaptive) {
+  const double a = 0.0;
+  const double b = 1.0;
+  const double tolerance = 1e-12;
+  const double expected_result = (std::atan(0.7 / 1e-3) + std::atan(0.3 / 1e-3)) / 1e-3;
+
+  std::vector<double> in = {a, b, tolerance};
+  std::vector<double> out(1, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t*>(in.data()));
+  taskDataSeq->inputs_count.emplace_back(in.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t*>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  auto testTaskSequential = std::make_shared<korablev_v_rect_int_seq::AdaptiveIntegrationSequential>(taskDataSeq);
+  testTaskSequential->set_function([](double x) { return 1.0 / (1e-6 + ((x - 0.3) * (x - 0.3))); });
+
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perfAttr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testTaskSequential);
+
+  perfAnalyzer->task_run(perfAttr, perfResults);
+
+  perfResults->counters["evaluations"] = static_cast<double>(testTaskSequential->result().evaluations);
+  perfResults->counters["error_estimate"] = testTaskSequential->result().error;
+  ppc::core::Perf::print_perf_statistic(perfResults);
+
+  ASSERT_NEAR(out[0], expected_result, 1e-9);
+}
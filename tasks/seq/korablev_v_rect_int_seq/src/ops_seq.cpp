@@ -1,8 +1,10 @@
 #include "seq/korablev_v_rect_int_seq/include/ops_seq.hpp"
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -27,7 +29,8 @@ bool korablev_v_rect_int_seq::RectangularIntegrationSequential::validation() {
 bool korablev_v_rect_int_seq::RectangularIntegrationSequential::run() {
   internal_order_test();
 
-  result_ = integrate(func_, a_, b_, n_);
+  // midpoint rule
+  result_ = sum_(a_, (b_ - a_) / n_, 0, n_);
 
   return true;
 }
@@ -39,20 +42,88 @@ bool korablev_v_rect_int_seq::RectangularIntegrationSequential::post_processing(
   return true;
 }
 
-double korablev_v_rect_int_seq::RectangularIntegrationSequential::integrate(const std::function<double(double)>& f,
-                                                                            double a, double b, int n) {
-  double step = (b - a) / n;
-  double area = 0.0;
+void korablev_v_rect_int_seq::RectangularIntegrationSequential::set_function(
+    const std::function<double(double)>& func) {
+  sum_ = ppc::core::make_range_sum(func, 0.5);
+}
+
+bool korablev_v_rect_int_seq::AdaptiveIntegrationSequential::pre_processing() {
+  internal_order_test();
+
+  auto* inputs = reinterpret_cast<double*>(taskData->inputs[0]);
 
-  for (int i = 0; i < n; ++i) {
-    double x = a + (i + 0.5) * step;
-    area += f(x) * step;
-  }
+  a_ = inputs[0];
+  b_ = inputs[1];
+  tolerance_ = inputs[2];
 
-  return area;
+  result_ = {};
+  return true;
 }
 
-void korablev_v_rect_int_seq::RectangularIntegrationSequential::set_function(
-    const std::function<double(double)>& func) {
-  func_ = func;
+bool korablev_v_rect_int_seq::AdaptiveIntegrationSequential::validation() {
+  internal_order_test();
+  return taskData->inputs_count[0] == 3 && taskData->outputs_count[0] == 1 &&
+         reinterpret_cast<double*>(taskData->inputs[0])[2] > 0.0;
+}
+
+bool korablev_v_rect_int_seq::AdaptiveIntegrationSequential::run() {
+  internal_order_test();
+
+  result_ = integral_(a_, b_, tolerance_);
+
+  return true;
+}
+
+bool korablev_v_rect_int_seq::AdaptiveIntegrationSequential::post_processing() {
+  internal_order_test();
+
+  reinterpret_cast<double*>(taskData->outputs[0])[0] = result_.value;
+  return true;
+}
+
+void korablev_v_rect_int_seq::AdaptiveIntegrationSequential::set_function(const std::function<double(double)>& func) {
+  integral_ = ppc::core::make_adaptive_integral(func, rule_);
+}
+
+bool korablev_v_rect_int_seq::MultidimIntegrationSequential::pre_processing() {
+  internal_order_test();
+
+  auto* lower = reinterpret_cast<double*>(taskData->inputs[0]);
+  auto* upper = reinterpret_cast<double*>(taskData->inputs[1]);
+  lower_.assign(lower, lower + taskData->inputs_count[0]);
+  upper_.assign(upper, upper + taskData->inputs_count[1]);
+  points_ = *reinterpret_cast<std::uint64_t*>(taskData->inputs[2]);
+
+  result_ = {};
+  return true;
+}
+
+bool korablev_v_rect_int_seq::MultidimIntegrationSequential::validation() {
+  internal_order_test();
+  return taskData->inputs_count[0] == taskData->inputs_count[1] && taskData->outputs_count[0] == 1 &&
+         ppc::core::Cubature::supports(taskData->inputs_count[0], method_,
+                                       *reinterpret_cast<std::uint64_t*>(taskData->inputs[2]));
+}
+
+bool korablev_v_rect_int_seq::MultidimIntegrationSequential::run() {
+  internal_order_test();
+
+  ppc::core::Cubature cubature(lower_, upper_, method_, points_);
+  std::vector<double> partials(cubature.partial_count());
+  items_(cubature, 0, cubature.items(), partials);
+  result_ = cubature.finish(partials);
+
+  return true;
+}
+
+bool korablev_v_rect_int_seq::MultidimIntegrationSequential::post_processing() {
+  internal_order_test();
+
+  reinterpret_cast<double*>(taskData->outputs[0])[0] = result_.value;
+  return true;
+}
+
+void korablev_v_rect_int_seq::MultidimIntegrationSequential::set_function(
+    const std::function<double(std::span<const double>)>& func) {
+  items_ = ppc::core::make_cubature_items(func);
 }
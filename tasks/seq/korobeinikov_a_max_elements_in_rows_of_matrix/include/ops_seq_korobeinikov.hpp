@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace korobeinikov_a_test_task_seq {
@@ -17,7 +19,7 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<int> input_;
+  ppc::core::Matrix<int> input_;
   std::vector<int> res;
   int count_rows{};
   int size_rows{};
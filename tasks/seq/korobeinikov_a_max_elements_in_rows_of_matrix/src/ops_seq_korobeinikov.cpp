@@ -2,24 +2,21 @@
 #include "seq/korobeinikov_a_max_elements_in_rows_of_matrix/include/ops_seq_korobeinikov.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <thread>
 
 using namespace std::chrono_literals;
 
 bool korobeinikov_a_test_task_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
-  // Init value for input and output
-
-  input_.reserve(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  std::copy(tmp_ptr, tmp_ptr + taskData->inputs_count[0], std::back_inserter(input_));
-  count_rows = (int)*taskData->inputs[1];
+  // the flat input viewed as count_rows x size_rows, without a copy
+  count_rows = *reinterpret_cast<int*>(taskData->inputs[1]);
   if (count_rows != 0) {
-    size_rows = (int)(taskData->inputs_count[0] / (*taskData->inputs[1]));
+    size_rows = static_cast<int>(taskData->inputs_count[0] / count_rows);
   } else {
     size_rows = 0;
   }
-
+  input_ = ppc::core::matrix_from_input<int>(*taskData, 0, count_rows, size_rows);
   res = std::vector<int>(count_rows, 0);
   return true;
 }
@@ -27,18 +24,16 @@ bool korobeinikov_a_test_task_seq::TestTaskSequential::pre_processing() {
 bool korobeinikov_a_test_task_seq::TestTaskSequential::validation() {
   internal_order_test();
 
-  if ((*taskData->inputs[1]) == 0) {
+  int rows = *reinterpret_cast<int*>(taskData->inputs[1]);
+  if (rows == 0) {
     return true;
   }
-  return (*taskData->inputs[1] == taskData->outputs_count[0] &&
-          (taskData->inputs_count[0] % (*taskData->inputs[1])) == 0);
+  return (static_cast<std::uint64_t>(rows) == taskData->outputs_count[0] && (taskData->inputs_count[0] % rows) == 0);
 }
 
 bool korobeinikov_a_test_task_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (int i = 0; i < count_rows; i++) {
-    res[i] = *std::max_element(input_.begin() + i * size_rows, input_.begin() + (i + 1) * size_rows);
-  }
+  ppc::core::reduce_matrix<ppc::core::MAX>(input_, ppc::core::BY_ROW, res);
   return true;
 }
 
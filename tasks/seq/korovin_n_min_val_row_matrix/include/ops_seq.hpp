@@ -4,6 +4,8 @@
 #include <string>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace korovin_n_min_val_row_matrix_seq {
@@ -21,7 +23,7 @@ class TestTaskSequential : public ppc::core::Task {
   static std::vector<std::vector<int>> generate_rnd_matrix(int rows, int cols);
 
  private:
-  std::vector<std::vector<int>> input_;
+  ppc::core::Matrix<int> input_;
   std::vector<int> res_;
 };
 
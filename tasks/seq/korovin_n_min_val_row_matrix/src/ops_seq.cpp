@@ -8,18 +8,8 @@ using namespace std::chrono_literals;
 bool korovin_n_min_val_row_matrix_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
 
-  int rows = taskData->inputs_count[0];
-  int cols = taskData->inputs_count[1];
-
-  input_.resize(rows, std::vector<int>(cols));
-
-  for (int i = 0; i < rows; i++) {
-    int* input_matrix = reinterpret_cast<int*>(taskData->inputs[i]);
-    for (int j = 0; j < cols; j++) {
-      input_[i][j] = input_matrix[j];
-    }
-  }
-  res_.resize(rows);
+  input_ = ppc::core::matrix_from_rows<int>(*taskData, taskData->inputs_count[0], taskData->inputs_count[1]);
+  res_.resize(input_.rows());
   return true;
 }
 
@@ -34,15 +24,7 @@ bool korovin_n_min_val_row_matrix_seq::TestTaskSequential::validation() {
 bool korovin_n_min_val_row_matrix_seq::TestTaskSequential::run() {
   internal_order_test();
 
-  for (size_t i = 0; i < input_.size(); i++) {
-    int min_val = input_[i][0];
-    for (size_t j = 1; j < input_[i].size(); j++) {
-      if (input_[i][j] < min_val) {
-        min_val = input_[i][j];
-      }
-    }
-    res_[i] = min_val;
-  }
+  ppc::core::reduce_matrix<ppc::core::MIN>(input_, ppc::core::BY_ROW, res_);
   return true;
 }
 
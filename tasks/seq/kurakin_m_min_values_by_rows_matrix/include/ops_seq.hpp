@@ -4,6 +4,8 @@
 #include <cstring>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace kurakin_m_min_values_by_rows_matrix_seq {
@@ -19,7 +21,7 @@ class TestTaskSequential : public ppc::core::Task {
  private:
   int count_rows{};
   int size_rows{};
-  std::vector<int> input_;
+  ppc::core::Matrix<int> input_;
   std::vector<int> res;
 };
 
@@ -2,6 +2,7 @@
 #include "seq/kurakin_m_min_values_by_rows_matrix/include/ops_seq.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <random>
 #include <thread>
@@ -10,15 +11,10 @@ using namespace std::chrono_literals;
 
 bool kurakin_m_min_values_by_rows_matrix_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
-  // Init vectors
-  input_ = std::vector<int>(taskData->inputs_count[0]);
-  auto* tmp_ptr = reinterpret_cast<int*>(taskData->inputs[0]);
-  for (unsigned i = 0; i < taskData->inputs_count[0]; i++) {
-    input_[i] = tmp_ptr[i];
-  }
-  // Init value for output
-  count_rows = (int)*taskData->inputs[1];
-  size_rows = (int)*taskData->inputs[2];
+  // the flat input viewed as count_rows x size_rows, without a copy
+  count_rows = *reinterpret_cast<int*>(taskData->inputs[1]);
+  size_rows = *reinterpret_cast<int*>(taskData->inputs[2]);
+  input_ = ppc::core::matrix_from_input<int>(*taskData, 0, count_rows, size_rows);
   res = std::vector<int>(count_rows, 0);
   return true;
 }
@@ -26,14 +22,12 @@ bool kurakin_m_min_values_by_rows_matrix_seq::TestTaskSequential::pre_processing
 bool kurakin_m_min_values_by_rows_matrix_seq::TestTaskSequential::validation() {
   internal_order_test();
   // Check count elements of output
-  return *taskData->inputs[1] == taskData->outputs_count[0];
+  return static_cast<std::uint64_t>(*reinterpret_cast<int*>(taskData->inputs[1])) == taskData->outputs_count[0];
 }
 
 bool kurakin_m_min_values_by_rows_matrix_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (int i = 0; i < count_rows; i++) {
-    res[i] = *std::min_element(input_.begin() + i * size_rows, input_.begin() + (i + 1) * size_rows);
-  }
+  ppc::core::reduce_matrix<ppc::core::MIN>(input_, ppc::core::BY_ROW, res);
   return true;
 }
 
@@ -94,4 +94,26 @@ TEST(lopatin_i_count_words_seq, test_6k_words) {
   testTask.post_processing();
 
   ASSERT_EQ(out[0], 6000);
-}
\ No newline at end of file
+}
+
+TEST(lopatin_i_count_words_seq, test_words_between_runs_of_whitespace) {
+  // words are runs of non-whitespace bytes: leading, trailing and repeated
+  // spaces, tabs and newlines don't add words
+  std::string testString = "  Leading,\tspaces  and\n\ntabs   between words  ";
+  std::vector<char> input(testString.begin(), testString.end());
+  std::vector<int> out(1, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskData = std::make_shared<ppc::core::TaskData>();
+  taskData->inputs.emplace_back(reinterpret_cast<uint8_t *>(input.data()));
+  taskData->inputs_count.emplace_back(input.size());
+  taskData->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskData->outputs_count.emplace_back(out.size());
+
+  lopatin_i_count_words_seq::TestTaskSequential testTask(taskData);
+  ASSERT_EQ(testTask.validation(), true);
+  testTask.pre_processing();
+  testTask.run();
+  testTask.post_processing();
+
+  ASSERT_EQ(out[0], 6);
+}
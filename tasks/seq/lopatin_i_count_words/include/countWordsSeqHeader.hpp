@@ -5,6 +5,7 @@
 #include <iterator>
 #include <sstream>
 
+#include "core/simd/include/text_scan.hpp"
 #include "core/task/include/task.hpp"
 
 namespace lopatin_i_count_words_seq {
@@ -21,7 +22,6 @@ class TestTaskSequential : public ppc::core::Task {
  private:
   std::vector<char> input_;
   int wordCount{};
-  int spaceCount{};
 };
 
 }  // namespace lopatin_i_count_words_seq
\ No newline at end of file
@@ -34,12 +34,7 @@ bool lopatin_i_count_words_seq::TestTaskSequential::validation() {
 
 bool lopatin_i_count_words_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (char c : input_) {
-    if (c == ' ') {
-      spaceCount++;
-    }
-  }
-  wordCount = spaceCount + 1;
+  wordCount = static_cast<int>(ppc::core::scan_text(input_.data(), input_.size()).words);
   return true;
 }
 
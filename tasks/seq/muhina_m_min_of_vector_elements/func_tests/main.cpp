@@ -140,3 +140,30 @@ TEST(muhina_m_min_of_vector_elements_seq, Test_Min_100) {
   MinOfVectorSequential.post_processing();
   ASSERT_EQ(0, out[0]);
 }
+
+TEST(muhina_m_min_of_vector_elements_seq, Test_Min_With_Position) {
+  // Create data
+  std::vector<int> in(100, 7);
+  in[41] = -5;
+  in[77] = -5;
+  std::vector<int> out(1, 0);
+  std::vector<uint64_t> out_index(1, 0);
+
+  // Create TaskData
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(in.data()));
+  taskDataSeq->inputs_count.emplace_back(in.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out_index.data()));
+  taskDataSeq->outputs_count.emplace_back(out_index.size());
+
+  // Create Task
+  muhina_m_min_of_vector_elements_seq::MinOfVectorSequential MinOfVectorSequential(taskDataSeq);
+  ASSERT_EQ(MinOfVectorSequential.validation(), true);
+  MinOfVectorSequential.pre_processing();
+  MinOfVectorSequential.run();
+  MinOfVectorSequential.post_processing();
+  ASSERT_EQ(-5, out[0]);
+  ASSERT_EQ(41ull, out_index[0]);
+}
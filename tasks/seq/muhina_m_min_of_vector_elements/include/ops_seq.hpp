@@ -1,13 +1,17 @@
 // Copyright 2023 Nesterov Alexander
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace muhina_m_min_of_vector_elements_seq {
-int vectorMin(std::vector<int, std::allocator<int>> v);
+// minimum and its first position
+ppc::core::Extremum<int> vectorMin(std::span<const int> v);
 
 class MinOfVectorSequential : public ppc::core::Task {
  public:
@@ -20,5 +24,6 @@ class MinOfVectorSequential : public ppc::core::Task {
  private:
   std::vector<int> input_;
   int res_{};
+  std::uint64_t res_index_{};
 };
 }  // namespace muhina_m_min_of_vector_elements_seq
\ No newline at end of file
@@ -6,15 +6,8 @@
 
 using namespace std::chrono_literals;
 
-int muhina_m_min_of_vector_elements_seq::vectorMin(std::vector<int, std::allocator<int>> vect) {
-  int mini = vect[0];
-
-  for (size_t i = 1; i < vect.size(); i++) {
-    if (vect[i] < mini) {
-      mini = vect[i];
-    }
-  }
-  return mini;
+ppc::core::Extremum<int> muhina_m_min_of_vector_elements_seq::vectorMin(std::span<const int> vect) {
+  return ppc::core::arg_reduce_elements<ppc::core::MIN>(vect.data(), vect.size());
 }
 
 bool muhina_m_min_of_vector_elements_seq::MinOfVectorSequential::pre_processing() {
@@ -32,6 +25,10 @@ bool muhina_m_min_of_vector_elements_seq::MinOfVectorSequential::pre_processing(
 
 bool muhina_m_min_of_vector_elements_seq::MinOfVectorSequential::validation() {
   internal_order_test();
+  // the position of the minimum is an optional second output
+  if (taskData->outputs_count.size() > 1 && taskData->outputs_count[1] != 1) {
+    return false;
+  }
   // Handle empty input vector
   if (taskData->inputs_count[0] == 0) {
     return taskData->outputs_count[0] == 0;
@@ -41,13 +38,18 @@ bool muhina_m_min_of_vector_elements_seq::MinOfVectorSequential::validation() {
 
 bool muhina_m_min_of_vector_elements_seq::MinOfVectorSequential::run() {
   internal_order_test();
-  // Iterate through the vector
-  res_ = muhina_m_min_of_vector_elements_seq::vectorMin(input_);
+  // value and position in one pass
+  auto min = muhina_m_min_of_vector_elements_seq::vectorMin(input_);
+  res_ = min.value;
+  res_index_ = min.index;
   return true;
 }
 
 bool muhina_m_min_of_vector_elements_seq::MinOfVectorSequential::post_processing() {
   internal_order_test();
   reinterpret_cast<int*>(taskData->outputs[0])[0] = res_;
+  if (taskData->outputs.size() > 1) {
+    reinterpret_cast<std::uint64_t*>(taskData->outputs[1])[0] = res_index_;
+  }
   return true;
 }
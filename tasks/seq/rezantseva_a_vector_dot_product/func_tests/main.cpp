@@ -1,6 +1,7 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <random>
 
 #include "seq/rezantseva_a_vector_dot_product/include/ops_seq.hpp"
@@ -17,7 +18,7 @@ std::vector<int> createRandomVector(int v_size) {
 TEST(rezantseva_a_vector_dot_product_seq, can_scalar_multiply_vec_size_10) {
   const int count = 10;
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count);
 
@@ -39,14 +40,14 @@ TEST(rezantseva_a_vector_dot_product_seq, can_scalar_multiply_vec_size_10) {
   testTaskSequential.pre_processing();
   testTaskSequential.run();
   testTaskSequential.post_processing();
-  int answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
+  std::int64_t answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
   ASSERT_EQ(answer, out[0]);
 }
 
 TEST(rezantseva_a_vector_dot_product_seq, can_scalar_multiply_vec_size_100) {
   const int count = 100;
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
 
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count);
@@ -69,14 +70,14 @@ TEST(rezantseva_a_vector_dot_product_seq, can_scalar_multiply_vec_size_100) {
   testTaskSequential.pre_processing();
   testTaskSequential.run();
   testTaskSequential.post_processing();
-  int answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
+  std::int64_t answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
   ASSERT_EQ(answer, out[0]);
 }
 
 TEST(rezantseva_a_vector_dot_product_seq, check_none_equal_size_of_vec) {
   const int count = 10;
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
 
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count + 1);
@@ -101,7 +102,7 @@ TEST(rezantseva_a_vector_dot_product_seq, check_none_equal_size_of_vec) {
 TEST(rezantseva_a_vector_dot_product_seq, check_equal_size_of_vec) {
   const int count = 10;
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
 
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count);
@@ -127,14 +128,14 @@ TEST(rezantseva_a_vector_dot_product_seq, check_empty_vec_product_func) {
   const int count = 0;
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count);
-  int answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
+  std::int64_t answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
   ASSERT_EQ(0, answer);
 }
 
 TEST(rezantseva_a_vector_dot_product_seq, check_empty_vec_product_run) {
   const int count = 0;
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
 
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count);
@@ -157,14 +158,14 @@ TEST(rezantseva_a_vector_dot_product_seq, check_empty_vec_product_run) {
   testTaskSequential.pre_processing();
   testTaskSequential.run();
   testTaskSequential.post_processing();
-  int answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
+  std::int64_t answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
   ASSERT_EQ(answer, out[0]);
 }
 
 TEST(rezantseva_a_vector_dot_product_seq, v1_dot_product_v2_equal_v2_dot_product_v1) {
   const int count = 50;
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
 
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count);
@@ -187,12 +188,12 @@ TEST(rezantseva_a_vector_dot_product_seq, v1_dot_product_v2_equal_v2_dot_product
   testTaskSequential.pre_processing();
   testTaskSequential.run();
   testTaskSequential.post_processing();
-  int answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v2, v1);
+  std::int64_t answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v2, v1);
   ASSERT_EQ(answer, out[0]);
 }
 TEST(rezantseva_a_vector_dot_product_seq, check_run_right) {
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
 
   std::vector<int> v1 = {1, 2, 5};
   std::vector<int> v2 = {4, 7, 8};
@@ -223,3 +224,121 @@ TEST(rezantseva_a_vector_dot_product_seq, check_vectorDotProduct_right) {
   std::vector<int> v2 = {4, 7, 8};
   ASSERT_EQ(58, rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2));
 }
+
+TEST(rezantseva_a_vector_dot_product_seq, check_run_does_not_overflow_int) {
+  // every product and the sum are far beyond int
+  const int count = 1000;
+  std::vector<std::int64_t> out(1, 0);
+  std::vector<int> v1(count, 2000000000);
+  std::vector<int> v2(count, -3000);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(v1.data()));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(v2.data()));
+  taskDataSeq->inputs_count.emplace_back(v1.size());
+  taskDataSeq->inputs_count.emplace_back(v2.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  rezantseva_a_vector_dot_product_seq::TestTaskSequential testTaskSequential(taskDataSeq);
+  ASSERT_EQ(testTaskSequential.validation(), true);
+  testTaskSequential.pre_processing();
+  testTaskSequential.run();
+  testTaskSequential.post_processing();
+  ASSERT_EQ(out[0], -6000000000000LL * count);
+  ASSERT_EQ(out[0], rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2));
+}
+
+TEST(rezantseva_a_vector_dot_product_seq, check_floating_compensated_run) {
+  // the ones cancel out in plain summation next to +-1e16
+  std::vector<double> v1;
+  std::vector<double> v2;
+  for (int i = 0; i < 100; i++) {
+    v1.insert(v1.end(), {1e16, 1.0, -1e16});
+    v2.insert(v2.end(), {1.0, 1.0, 1.0});
+  }
+  std::vector<double> out(1, 0.0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(v1.data()));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(v2.data()));
+  taskDataSeq->inputs_count.emplace_back(v1.size());
+  taskDataSeq->inputs_count.emplace_back(v2.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  rezantseva_a_vector_dot_product_seq::FloatingDotProductSequential<double> testTaskSequential(
+      taskDataSeq, ppc::core::COMPENSATED);
+  ASSERT_EQ(testTaskSequential.validation(), true);
+  testTaskSequential.pre_processing();
+  testTaskSequential.run();
+  testTaskSequential.post_processing();
+  ASSERT_DOUBLE_EQ(out[0], 100.0);
+}
+
+TEST(rezantseva_a_vector_dot_product_seq, check_batched_matrix_vector) {
+  const int rows = 5;
+  const int cols = 3;
+  std::vector<int> matrix = {1, 2, 3, 4, 5, 6, 7, 8, 9, -1, 0, 1, 0, 0, 0};
+  std::vector<int> x = {1, -2, 3};
+  std::vector<std::int64_t> out(rows, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix.data()));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(x.data()));
+  taskDataSeq->inputs_count.emplace_back(matrix.size());
+  taskDataSeq->inputs_count.emplace_back(cols);
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(rows);
+
+  rezantseva_a_vector_dot_product_seq::BatchedDotProductSequential testTaskSequential(taskDataSeq);
+  ASSERT_EQ(testTaskSequential.validation(), true);
+  testTaskSequential.pre_processing();
+  testTaskSequential.run();
+  testTaskSequential.post_processing();
+  ASSERT_EQ(out, std::vector<std::int64_t>({6, 12, 18, 2, 0}));
+}
+
+TEST(rezantseva_a_vector_dot_product_seq, check_batched_pairs) {
+  const int rows = 40;
+  const int cols = 9;
+  std::vector<int> a = createRandomVector(rows * cols);
+  std::vector<int> b = createRandomVector(rows * cols);
+  std::vector<std::int64_t> out(rows, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(a.data()));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(b.data()));
+  taskDataSeq->inputs_count.emplace_back(a.size());
+  taskDataSeq->inputs_count.emplace_back(b.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(rows);
+
+  rezantseva_a_vector_dot_product_seq::BatchedDotProductSequential testTaskSequential(taskDataSeq);
+  ASSERT_EQ(testTaskSequential.validation(), true);
+  testTaskSequential.pre_processing();
+  testTaskSequential.run();
+  testTaskSequential.post_processing();
+  for (int r = 0; r < rows; r++) {
+    std::vector<int> row_a(a.begin() + (r * cols), a.begin() + ((r + 1) * cols));
+    std::vector<int> row_b(b.begin() + (r * cols), b.begin() + ((r + 1) * cols));
+    ASSERT_EQ(out[r], rezantseva_a_vector_dot_product_seq::vectorDotProduct(row_a, row_b));
+  }
+}
+
+TEST(rezantseva_a_vector_dot_product_seq, check_batched_rejects_ragged_matrix) {
+  std::vector<int> matrix(10);
+  std::vector<int> x(3);
+  std::vector<std::int64_t> out(3, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix.data()));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(x.data()));
+  taskDataSeq->inputs_count.emplace_back(matrix.size());
+  taskDataSeq->inputs_count.emplace_back(x.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  rezantseva_a_vector_dot_product_seq::BatchedDotProductSequential testTaskSequential(taskDataSeq);
+  ASSERT_EQ(testTaskSequential.validation(), false);
+}
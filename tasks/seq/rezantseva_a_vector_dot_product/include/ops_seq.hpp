@@ -1,13 +1,16 @@
 // Copyright 2023 Nesterov Alexander
 #pragma once
 
+#include <concepts>
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "core/simd/include/dot_product.hpp"
 #include "core/task/include/task.hpp"
 
 namespace rezantseva_a_vector_dot_product_seq {
-int vectorDotProduct(const std::vector<int>& v1, const std::vector<int>& v2);
+std::int64_t vectorDotProduct(const std::vector<int>& v1, const std::vector<int>& v2);
 
 class TestTaskSequential : public ppc::core::Task {
  public:
@@ -18,8 +21,73 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  int res{};
+  std::int64_t res{};
   std::vector<std::vector<int>> input_;
 };
 
+// Dot products of the rows of an N x K int matrix (inputs[0], row-major,
+// N * K elements) with either one shared K-vector (inputs[1] of K
+// elements, a matrix-vector product) or the rows of a second N x K matrix
+// (inputs[1] of N * K elements, independent pairs). N is outputs_count[0],
+// outputs[0] gets N int64 results.
+class BatchedDotProductSequential : public ppc::core::Task {
+ public:
+  explicit BatchedDotProductSequential(std::shared_ptr<ppc::core::TaskData> taskData_) : Task(std::move(taskData_)) {}
+  bool pre_processing() override;
+  bool validation() override;
+  bool run() override;
+  bool post_processing() override;
+
+ private:
+  const int* matrix_{};
+  const int* other_{};
+  std::size_t rows_{};
+  std::size_t cols_{};
+  bool pairs_{};
+  std::vector<std::int64_t> res_;
+};
+
+// Dot product of two float or double vectors, the output is a single T.
+template <std::floating_point T>
+class FloatingDotProductSequential : public ppc::core::Task {
+ public:
+  explicit FloatingDotProductSequential(std::shared_ptr<ppc::core::TaskData> taskData_,
+                                        ppc::core::Summation summation = ppc::core::PLAIN)
+      : Task(std::move(taskData_)), summation_(summation) {}
+
+  bool validation() override {
+    internal_order_test();
+    return taskData->inputs.size() == 2 && taskData->inputs_count.size() == 2 &&
+           taskData->inputs_count[0] == taskData->inputs_count[1] && taskData->outputs.size() == 1 &&
+           taskData->outputs_count.size() == 1 && taskData->outputs_count[0] == 1;
+  }
+
+  bool pre_processing() override {
+    internal_order_test();
+    a_ = reinterpret_cast<const T*>(taskData->inputs[0]);
+    b_ = reinterpret_cast<const T*>(taskData->inputs[1]);
+    n_ = taskData->inputs_count[0];
+    return true;
+  }
+
+  bool run() override {
+    internal_order_test();
+    res_ = ppc::core::dot_product(a_, b_, n_, summation_);
+    return true;
+  }
+
+  bool post_processing() override {
+    internal_order_test();
+    reinterpret_cast<T*>(taskData->outputs[0])[0] = res_;
+    return true;
+  }
+
+ private:
+  ppc::core::Summation summation_;
+  const T* a_{};
+  const T* b_{};
+  std::size_t n_{};
+  T res_{};
+};
+
 }  // namespace rezantseva_a_vector_dot_product_seq
\ No newline at end of file
@@ -1,6 +1,7 @@
 // Copyright 2023 Nesterov Alexander
 #include <gtest/gtest.h>
 
+#include <cstdint>
 #include <random>
 
 #include "core/perf/include/perf.hpp"
@@ -19,7 +20,7 @@ std::vector<int> createRandomVector(int v_size) {
 TEST(rezantseva_a_vector_dot_product_seq, test_pipeline_run) {
   const int count = 100000000;
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
 
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count);
@@ -57,14 +58,14 @@ TEST(rezantseva_a_vector_dot_product_seq, test_pipeline_run) {
   perfAnalyzer->pipeline_run(perfAttr, perfResults);
   ppc::core::Perf::print_perf_statistic(perfResults);
 
-  int answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
+  std::int64_t answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
   ASSERT_EQ(answer, out[0]);
 }
 
 TEST(rezantseva_a_vector_dot_product_seq, test_task_run) {
   const int count = 100000000;
   // Create data
-  std::vector<int> out(1, 0);
+  std::vector<std::int64_t> out(1, 0);
 
   std::vector<int> v1 = createRandomVector(count);
   std::vector<int> v2 = createRandomVector(count);
@@ -99,8 +100,47 @@ TEST(rezantseva_a_vector_dot_product_seq, test_task_run) {
   // Create Perf analyzer
   auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testTaskSequential);
   perfAnalyzer->task_run(perfAttr, perfResults);
+  perfResults->counters["elements_per_sec"] =
+      static_cast<double>(count) * perfAttr->num_running / perfResults->time_sec;
   ppc::core::Perf::print_perf_statistic(perfResults);
 
-  int answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
+  std::int64_t answer = rezantseva_a_vector_dot_product_seq::vectorDotProduct(v1, v2);
   ASSERT_EQ(answer, out[0]);
-}
\ No newline at end of file
+}
+TEST(rezantseva_a_vector_dot_product_seq, test_task_run_batched) {
+  // one query vector against many stored ones
+  const int rows = 8192;
+  const int cols = 2048;
+  std::vector<int> matrix = createRandomVector(rows * cols);
+  std::vector<int> x = createRandomVector(cols);
+  std::vector<std::int64_t> out(rows, 0);
+
+  std::shared_ptr<ppc::core::TaskData> taskDataSeq = std::make_shared<ppc::core::TaskData>();
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(matrix.data()));
+  taskDataSeq->inputs.emplace_back(reinterpret_cast<uint8_t *>(x.data()));
+  taskDataSeq->inputs_count.emplace_back(matrix.size());
+  taskDataSeq->inputs_count.emplace_back(x.size());
+  taskDataSeq->outputs.emplace_back(reinterpret_cast<uint8_t *>(out.data()));
+  taskDataSeq->outputs_count.emplace_back(out.size());
+
+  auto testTaskSequential =
+      std::make_shared<rezantseva_a_vector_dot_product_seq::BatchedDotProductSequential>(taskDataSeq);
+  auto perfAttr = std::make_shared<ppc::core::PerfAttr>();
+  perfAttr->num_running = 10;
+  const auto t0 = std::chrono::high_resolution_clock::now();
+  perfAttr->current_timer = [&] {
+    auto current_time_point = std::chrono::high_resolution_clock::now();
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(current_time_point - t0).count();
+    return static_cast<double>(duration) * 1e-9;
+  };
+  auto perfResults = std::make_shared<ppc::core::PerfResults>();
+  auto perfAnalyzer = std::make_shared<ppc::core::Perf>(testTaskSequential);
+  perfAnalyzer->task_run(perfAttr, perfResults);
+  perfResults->counters["gflops"] = 2.0 * rows * cols * perfAttr->num_running / perfResults->time_sec * 1e-9;
+  ppc::core::Perf::print_perf_statistic(perfResults);
+
+  std::vector<int> first_row(matrix.begin(), matrix.begin() + cols);
+  std::vector<int> last_row(matrix.end() - cols, matrix.end());
+  ASSERT_EQ(out[0], rezantseva_a_vector_dot_product_seq::vectorDotProduct(first_row, x));
+  ASSERT_EQ(out[rows - 1], rezantseva_a_vector_dot_product_seq::vectorDotProduct(last_row, x));
+}
@@ -1,6 +1,8 @@
 // Copyright 2024 Nesterov Alexander
 #include "seq/rezantseva_a_vector_dot_product/include/ops_seq.hpp"
 
+#include <algorithm>
+
 bool rezantseva_a_vector_dot_product_seq::TestTaskSequential::validation() {
   internal_order_test();
   // Check count elements of output
@@ -28,21 +30,60 @@ bool rezantseva_a_vector_dot_product_seq::TestTaskSequential::pre_processing() {
 
 bool rezantseva_a_vector_dot_product_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < input_[0].size(); i++) {
-    res += input_[0][i] * input_[1][i];
+  res = ppc::core::dot_product(input_[0].data(), input_[1].data(), input_[0].size());
+  return true;
+}
+
+bool rezantseva_a_vector_dot_product_seq::TestTaskSequential::post_processing() {
+  internal_order_test();
+  reinterpret_cast<std::int64_t*>(taskData->outputs[0])[0] = res;
+  return true;
+}
+
+bool rezantseva_a_vector_dot_product_seq::BatchedDotProductSequential::validation() {
+  internal_order_test();
+  if (taskData->inputs.size() != 2 || taskData->inputs_count.size() != 2 || taskData->outputs.size() != 1 ||
+      taskData->outputs_count.size() != 1 || taskData->outputs_count[0] == 0) {
+    return false;
   }
+  auto rows = taskData->outputs_count[0];
+  auto cols = taskData->inputs_count[0] / rows;
+  return taskData->inputs_count[0] % rows == 0 &&
+         (taskData->inputs_count[1] == cols || taskData->inputs_count[1] == taskData->inputs_count[0]);
+}
 
+bool rezantseva_a_vector_dot_product_seq::BatchedDotProductSequential::pre_processing() {
+  internal_order_test();
+  matrix_ = reinterpret_cast<const int*>(taskData->inputs[0]);
+  other_ = reinterpret_cast<const int*>(taskData->inputs[1]);
+  rows_ = taskData->outputs_count[0];
+  cols_ = taskData->inputs_count[0] / rows_;
+  pairs_ = rows_ > 1 && taskData->inputs_count[1] == taskData->inputs_count[0];
+  res_.resize(rows_);
   return true;
 }
 
-bool rezantseva_a_vector_dot_product_seq::TestTaskSequential::post_processing() {
+bool rezantseva_a_vector_dot_product_seq::BatchedDotProductSequential::run() {
+  internal_order_test();
+  if (pairs_) {
+    for (std::size_t r = 0; r < rows_; r++) {
+      res_[r] = ppc::core::dot_product(matrix_ + (r * cols_), other_ + (r * cols_), cols_);
+    }
+  } else {
+    ppc::core::batched_dot_product(matrix_, rows_, cols_, cols_, other_, res_.data());
+  }
+  return true;
+}
+
+bool rezantseva_a_vector_dot_product_seq::BatchedDotProductSequential::post_processing() {
   internal_order_test();
-  reinterpret_cast<int*>(taskData->outputs[0])[0] = res;
+  std::copy(res_.begin(), res_.end(), reinterpret_cast<std::int64_t*>(taskData->outputs[0]));
   return true;
 }
 
-int rezantseva_a_vector_dot_product_seq::vectorDotProduct(const std::vector<int>& v1, const std::vector<int>& v2) {
-  long long result = 0;
-  for (size_t i = 0; i < v1.size(); i++) result += v1[i] * v2[i];
+std::int64_t rezantseva_a_vector_dot_product_seq::vectorDotProduct(const std::vector<int>& v1,
+                                                                   const std::vector<int>& v2) {
+  std::int64_t result = 0;
+  for (size_t i = 0; i < v1.size(); i++) result += static_cast<std::int64_t>(v1[i]) * v2[i];
   return result;
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 
+#include "core/simd/include/text_scan.hpp"
 #include "core/task/include/task.hpp"
 
 namespace shvedova_v_char_frequency_seq {
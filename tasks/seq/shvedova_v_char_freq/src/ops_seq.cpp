@@ -21,7 +21,7 @@ bool shvedova_v_char_frequency_seq::CharFrequencyTaskSequential::validation() {
 
 bool shvedova_v_char_frequency_seq::CharFrequencyTaskSequential::run() {
   internal_order_test();
-  frequency_ = std::count(input_str_.begin(), input_str_.end(), target_char_);
+  frequency_ = static_cast<int>(ppc::core::count_byte(input_str_.data(), input_str_.size(), target_char_));
   return true;
 }
 
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "core/matrix/include/matrix.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sorokin_a_check_lexicographic_order_of_strings_seq {
@@ -17,7 +18,7 @@ class TestTaskSequential : public ppc::core::Task {
   bool post_processing() override;
 
  private:
-  std::vector<std::vector<char>> input_;
+  ppc::core::Matrix<char> input_;
   int res_{};
 };
 
@@ -7,14 +7,7 @@ using namespace std::chrono_literals;
 
 bool sorokin_a_check_lexicographic_order_of_strings_seq::TestTaskSequential::pre_processing() {
   internal_order_test();
-  input_ = std::vector<std::vector<char>>(taskData->inputs_count[0], std::vector<char>(taskData->inputs_count[1]));
-
-  for (unsigned int i = 0; i < taskData->inputs_count[0]; i++) {
-    auto* tmp_ptr = reinterpret_cast<char*>(taskData->inputs[i]);
-    for (unsigned int j = 0; j < taskData->inputs_count[1]; j++) {
-      input_[i][j] = tmp_ptr[j];
-    }
-  }
+  input_ = ppc::core::matrix_from_rows<char>(*taskData, taskData->inputs_count[0], taskData->inputs_count[1]);
   res_ = 0;
   return true;
 }
@@ -26,12 +19,12 @@ bool sorokin_a_check_lexicographic_order_of_strings_seq::TestTaskSequential::val
 
 bool sorokin_a_check_lexicographic_order_of_strings_seq::TestTaskSequential::run() {
   internal_order_test();
-  for (size_t i = 0; i < std::min(input_[0].size(), input_[1].size()); ++i) {
-    if (static_cast<int>(input_[0][i]) > static_cast<int>(input_[1][i])) {
+  for (size_t i = 0; i < input_.cols(); ++i) {
+    if (static_cast<int>(input_(0, i)) > static_cast<int>(input_(1, i))) {
       res_ = 1;
       break;
     }
-    if (static_cast<int>(input_[0][i]) < static_cast<int>(input_[1][i])) {
+    if (static_cast<int>(input_(0, i)) < static_cast<int>(input_(1, i))) {
       break;
     }
   }
@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "core/simd/include/matrix_reduction.hpp"
 #include "core/task/include/task.hpp"
 
 namespace sotskov_a_sum_element_matrix_seq {
@@ -2,15 +2,14 @@
 
 #include <algorithm>
 #include <iostream>
-#include <numeric>
 #include <random>
 
 int sotskov_a_sum_element_matrix_seq::sum_matrix_elements_int(const std::vector<int>& matrix) {
-  return std::accumulate(matrix.begin(), matrix.end(), 0);
+  return ppc::core::reduce_elements<ppc::core::SUM, int>(matrix.data(), matrix.size());
 }
 
 double sotskov_a_sum_element_matrix_seq::sum_matrix_elements_double(const std::vector<double>& matrix) {
-  return std::accumulate(matrix.begin(), matrix.end(), 0.0);
+  return ppc::core::reduce_elements<ppc::core::SUM, double>(matrix.data(), matrix.size());
 }
 
 int sotskov_a_sum_element_matrix_seq::random_range(int min, int max) {
@@ -67,7 +66,7 @@ bool sotskov_a_sum_element_matrix_seq::TestTaskSequentialInt::validation() {
 
 bool sotskov_a_sum_element_matrix_seq::TestTaskSequentialInt::run() {
   internal_order_test();
-  result_ = std::accumulate(input_data_.begin(), input_data_.end(), 0);
+  result_ = sum_matrix_elements_int(input_data_);
   return true;
 }
 
@@ -99,7 +98,7 @@ bool sotskov_a_sum_element_matrix_seq::TestTaskSequentialDouble::validation() {
 
 bool sotskov_a_sum_element_matrix_seq::TestTaskSequentialDouble::run() {
   internal_order_test();
-  result_ = std::accumulate(input_data_.begin(), input_data_.end(), 0.0);
+  result_ = sum_matrix_elements_double(input_data_);
   return true;
 }
 